@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/ascii.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <cctype>
+#include <chrono>
+#include <clocale>
+#include <string>
+#include <string_view>
+
+using namespace timeduration;
+
+namespace {
+    // Mixed ASCII and UTF-8, as found in hand-edited configs
+    constexpr std::string_view INPUT = "1h 30m 250\xC2\xB5s 2d 15s \xE2\x80\x94 45m 3mo";
+
+    // Services set a non-"C" global locale at startup; parsing must not care
+    void SetServiceLocale(const benchmark::State &) {
+        if (!std::setlocale(LC_ALL, "C.UTF-8"))
+            std::setlocale(LC_ALL, "");
+    }
+
+    void ResetLocale(const benchmark::State &) {
+        std::setlocale(LC_ALL, "C");
+    }
+
+    // The classification the scanner used before: a call into the locale for each byte
+    size_t CountWithCType(const std::string_view Text) {
+        size_t Count = 0;
+        for (const char c: Text)
+            Count += isdigit(static_cast<unsigned char>(c)) || isalpha(static_cast<unsigned char>(c));
+        return Count;
+    }
+
+    size_t CountWithTable(const std::string_view Text) {
+        size_t Count = 0;
+        for (const char c: Text)
+            Count += detail::HasCharClass(c, detail::CHAR_DIGIT | detail::CHAR_ALPHA);
+        return Count;
+    }
+}
+
+static void BM_ClassifyCType(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(CountWithCType(INPUT));
+    State.SetBytesProcessed(State.iterations() * static_cast<int64_t>(INPUT.size()));
+}
+BENCHMARK(BM_ClassifyCType)->Setup(SetServiceLocale)->Teardown(ResetLocale);
+
+static void BM_ClassifyTable(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(CountWithTable(INPUT));
+    State.SetBytesProcessed(State.iterations() * static_cast<int64_t>(INPUT.size()));
+}
+BENCHMARK(BM_ClassifyTable)->Setup(SetServiceLocale)->Teardown(ResetLocale);
+
+static void BM_ParseUnderLocale(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(CTimePeriod::Parse(INPUT));
+}
+BENCHMARK(BM_ParseUnderLocale)->Setup(SetServiceLocale)->Teardown(ResetLocale);
+
+static void BM_TryParseUnderLocale(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State)
+        benchmark::DoNotOptimize(CTimePeriod::TryParse(INPUT, Out));
+}
+BENCHMARK(BM_TryParseUnderLocale)->Setup(SetServiceLocale)->Teardown(ResetLocale);
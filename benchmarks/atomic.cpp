@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/atomic.hpp>
+
+#include <chrono>
+#include <mutex>
+
+using namespace timeduration;
+
+namespace {
+    const CTimePeriod REQUEST_TIME(std::chrono::seconds(3));
+
+    // The pattern from the README: a mutex around CTimePeriod arithmetic
+    struct SLockedTotal {
+        std::mutex m_Mutex;
+        CTimePeriod m_Total;
+    };
+
+    SLockedTotal s_Locked;
+    CAtomicDuration s_Atomic;
+    CDurationAccumulator s_Sharded(64);
+}
+
+static void BM_AccumulateMutex(benchmark::State &State) {
+    for (auto _: State) {
+        const std::lock_guard Lock(s_Locked.m_Mutex);
+        s_Locked.m_Total = CTimePeriod(s_Locked.m_Total.duration() + REQUEST_TIME.duration());
+    }
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_AccumulateMutex)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_AccumulateAtomic(benchmark::State &State) {
+    for (auto _: State)
+        s_Atomic.Add(REQUEST_TIME);
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_AccumulateAtomic)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_AccumulateSharded(benchmark::State &State) {
+    for (auto _: State)
+        s_Sharded.Add(REQUEST_TIME);
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_AccumulateSharded)->ThreadRange(1, 64)->UseRealTime();
+
+// Cost of a combined read over 64 shards
+static void BM_AccumulatorLoad(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(s_Sharded.Load());
+}
+BENCHMARK(BM_AccumulatorLoad);
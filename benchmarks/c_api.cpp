@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/timeduration_c.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> RandomInputs(const size_t Count) {
+        std::mt19937 Rng(7);
+        std::uniform_int_distribution<int> Dist(0, 59);
+        std::vector<std::string> Inputs;
+        Inputs.reserve(Count);
+        for (size_t i = 0; i < Count; ++i)
+            Inputs.push_back(std::to_string(Dist(Rng)) + "h " + std::to_string(Dist(Rng)) + "m");
+        return Inputs;
+    }
+
+    std::vector<td_string_view> Views(const std::vector<std::string> &Inputs) {
+        std::vector<td_string_view> Result;
+        Result.reserve(Inputs.size());
+        for (const auto &Input: Inputs)
+            Result.push_back({Input.data(), Input.size()});
+        return Result;
+    }
+}
+
+// One boundary crossing per value, what per-value FFI shims do
+static void BM_CParseSingle(benchmark::State &State) {
+    const auto Inputs = RandomInputs(State.range(0));
+    std::vector<int64_t> Seconds(Inputs.size());
+    for (auto _: State) {
+        for (size_t i = 0; i < Inputs.size(); ++i)
+            benchmark::DoNotOptimize(td_parse(Inputs[i].data(), Inputs[i].size(), &Seconds[i]));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_CParseSingle)->Arg(1000);
+
+static void BM_CParseBatch(benchmark::State &State) {
+    const auto Inputs = RandomInputs(State.range(0));
+    const auto Batch = Views(Inputs);
+    std::vector<int64_t> Seconds(Inputs.size());
+    std::vector<td_status> Status(Inputs.size());
+    for (auto _: State) {
+        benchmark::DoNotOptimize(td_parse_batch(Batch.data(), Batch.size(), Seconds.data(), Status.data()));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_CParseBatch)->Arg(1000);
+
+static void BM_CFormatSingle(benchmark::State &State) {
+    std::vector<int64_t> Seconds(State.range(0));
+    std::mt19937_64 Rng(7);
+    for (auto &Value: Seconds)
+        Value = static_cast<int64_t>(Rng() % (90 * 86400));
+    char Buffer[64];
+    for (auto _: State) {
+        for (const int64_t Value: Seconds) {
+            size_t Length = 0;
+            benchmark::DoNotOptimize(td_format(Value, Buffer, sizeof(Buffer), &Length));
+        }
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_CFormatSingle)->Arg(1000);
+
+static void BM_CFormatBatch(benchmark::State &State) {
+    std::vector<int64_t> Seconds(State.range(0));
+    std::mt19937_64 Rng(7);
+    for (auto &Value: Seconds)
+        Value = static_cast<int64_t>(Rng() % (90 * 86400));
+    std::vector<char> Buffer(Seconds.size() * 32);
+    std::vector<size_t> Offsets(Seconds.size() + 1);
+    for (auto _: State) {
+        size_t Required = 0;
+        benchmark::DoNotOptimize(td_format_batch(Seconds.data(), Seconds.size(), Buffer.data(), Buffer.size(),
+                                                 Offsets.data(), &Required));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_CFormatBatch)->Arg(1000);
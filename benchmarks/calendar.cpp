@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/calendar.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono;
+
+namespace {
+    constexpr size_t NUM_TIMESTAMPS = 10'000'000;
+
+    // Renewal timestamps spread over 2000..2040, optionally sorted so that equal days are adjacent
+    const std::vector<sys_seconds> &Timestamps(const bool Sorted) {
+        static const auto s_Build = [](const bool Sort) {
+            std::mt19937_64 Rng(42);
+            std::uniform_int_distribution<int64_t> Dist(946684800, 2208988800);
+            std::vector<sys_seconds> Result(NUM_TIMESTAMPS);
+            for (auto &Time: Result)
+                Time = sys_seconds{seconds(Dist(Rng))};
+            if (Sort)
+                std::sort(Result.begin(), Result.end());
+            return Result;
+        };
+        static const std::vector<sys_seconds> s_Random = s_Build(false);
+        static const std::vector<sys_seconds> s_Sorted = s_Build(true);
+        return Sorted ? s_Sorted : s_Random;
+    }
+
+    const SCalendarPeriod RENEWAL{1, seconds(0)};
+}
+
+// std::chrono calendar types, clamped with year_month_day_last
+static void BM_CalendarChrono(benchmark::State &State) {
+    const auto &Input = Timestamps(State.range(0) != 0);
+    std::vector<sys_seconds> Output(Input.size());
+    for (auto _: State) {
+        for (size_t i = 0; i < Input.size(); ++i) {
+            const sys_days Day = floor<days>(Input[i]);
+            year_month_day Date = year_month_day(Day) + months(RENEWAL.m_Months);
+            if (!Date.ok())
+                Date = Date.year() / Date.month() / last;
+            Output[i] = sys_days(Date) + (Input[i] - Day) + RENEWAL.m_Exact;
+        }
+        benchmark::DoNotOptimize(Output.data());
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Input.size()));
+}
+BENCHMARK(BM_CalendarChrono)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_CalendarScalar(benchmark::State &State) {
+    const auto &Input = Timestamps(State.range(0) != 0);
+    std::vector<sys_seconds> Output(Input.size());
+    for (auto _: State) {
+        for (size_t i = 0; i < Input.size(); ++i)
+            Output[i] = AddCalendar(Input[i], RENEWAL);
+        benchmark::DoNotOptimize(Output.data());
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Input.size()));
+}
+BENCHMARK(BM_CalendarScalar)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_CalendarBatch(benchmark::State &State) {
+    const auto &Input = Timestamps(State.range(0) != 0);
+    std::vector<sys_seconds> Output(Input.size());
+    for (auto _: State) {
+        AddCalendar(Input, RENEWAL, Output);
+        benchmark::DoNotOptimize(Output.data());
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Input.size()));
+}
+BENCHMARK(BM_CalendarBatch)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_TryParseCalendar(benchmark::State &State) {
+    SCalendarPeriod Period;
+    for (auto _: State)
+        benchmark::DoNotOptimize(TryParseCalendar("1y 2mo 3d", Period));
+}
+BENCHMARK(BM_TryParseCalendar);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/canonical.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    /*
+     * Traffic-like inputs: 80% popular short strings ("30s", "5m", "1h 30m"), 15% other
+     * canonical values below a day ("2h 17m 3s"), 5% longer ones ("3d 4h 12m").
+     */
+    const std::vector<std::string> &Inputs() {
+        static const std::vector<std::string> s_vInputs = [] {
+            const std::vector<std::string> vPopular = {"30s", "5m", "1m", "10s", "15m", "1h", "30m", "1h 30m",
+                                                       "24h", "90s", "2h", "10m", "7d", "45s", "1m 30s", "12h"};
+            std::mt19937_64 Rng(7);
+            std::vector<std::string> vInputs(4096);
+            for (auto &Input: vInputs) {
+                const uint64_t Roll = Rng() % 100;
+                if (Roll < 80)
+                    Input = vPopular[Rng() % vPopular.size()];
+                else if (Roll < 95)
+                    Input = CTimePeriod(std::chrono::seconds(Rng() % 86400)).toString();
+                else
+                    Input = CTimePeriod(std::chrono::seconds(86400 + Rng() % (30 * 86400))).toString();
+            }
+            return vInputs;
+        }();
+        return s_vInputs;
+    }
+
+    // 95% below a day
+    const std::vector<std::chrono::seconds> &Durations() {
+        static const std::vector<std::chrono::seconds> s_vDurations = [] {
+            std::mt19937_64 Rng(11);
+            std::vector<std::chrono::seconds> vDurations(4096);
+            for (auto &Duration: vDurations)
+                Duration = std::chrono::seconds(Rng() % 100 < 95 ? Rng() % 86400 : 86400 + Rng() % (30 * 86400));
+            return vDurations;
+        }();
+        return s_vDurations;
+    }
+}
+
+static void BM_CanonicalTryParse(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        for (const auto &Input: Inputs())
+            benchmark::DoNotOptimize(CTimePeriod::TryParse(Input, Out));
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Inputs().size()));
+}
+BENCHMARK(BM_CanonicalTryParse);
+
+static void BM_CanonicalTryParseCommon(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        for (const auto &Input: Inputs())
+            benchmark::DoNotOptimize(TryParseCommon(Input, Out));
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Inputs().size()));
+}
+BENCHMARK(BM_CanonicalTryParseCommon);
+
+static void BM_CanonicalToString(benchmark::State &State) {
+    std::vector<CTimePeriod> vPeriods(Durations().begin(), Durations().end());
+    for (auto _: State) {
+        for (const auto &Period: vPeriods)
+            benchmark::DoNotOptimize(Period.toString());
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(vPeriods.size()));
+}
+BENCHMARK(BM_CanonicalToString);
+
+static void BM_CanonicalFormatDisplay(benchmark::State &State) {
+    char Buffer[DISPLAY_MAX_LENGTH];
+    for (auto _: State) {
+        for (const auto Duration: Durations())
+            benchmark::DoNotOptimize(FormatDisplay(Duration, Buffer));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Durations().size()));
+}
+BENCHMARK(BM_CanonicalFormatDisplay);
+
+static void BM_CanonicalFormat(benchmark::State &State) {
+    char Buffer[DISPLAY_MAX_LENGTH];
+    for (auto _: State) {
+        for (const auto Duration: Durations())
+            benchmark::DoNotOptimize(FormatCanonical(Duration, Buffer));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(Durations().size()));
+}
+BENCHMARK(BM_CanonicalFormat);
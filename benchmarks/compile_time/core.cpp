@@ -0,0 +1,11 @@
+// Config struct holding a period by value
+#include <timeduration/core.hpp>
+
+struct SConfig {
+    timeduration::CTimePeriod m_Timeout{30};
+    timeduration::CTimePeriod m_Retention{0, 0, 0, 7};
+};
+
+bool RetainsLonger(const SConfig &Lhs, const SConfig &Rhs) {
+    return Lhs.m_Retention > Rhs.m_Retention && !Lhs.m_Timeout.isZero();
+}
@@ -0,0 +1,7 @@
+// Logging of a period
+#include <timeduration/core.hpp>
+#include <timeduration/format.hpp>
+
+std::string Describe(const timeduration::CTimePeriod &Period) {
+    return Period.toString() + " (" + Period.asSqlInterval() + ")";
+}
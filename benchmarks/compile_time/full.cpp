@@ -0,0 +1,11 @@
+// The same config struct through the umbrella header, which every TU used before the split
+#include <timeduration/timeduration.hpp>
+
+struct SConfig {
+    timeduration::CTimePeriod m_Timeout{30};
+    timeduration::CTimePeriod m_Retention{0, 0, 0, 7};
+};
+
+bool RetainsLonger(const SConfig &Lhs, const SConfig &Rhs) {
+    return Lhs.m_Retention > Rhs.m_Retention && !Lhs.m_Timeout.isZero();
+}
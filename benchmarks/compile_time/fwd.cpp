@@ -0,0 +1,10 @@
+// Header that only passes periods around
+#include <timeduration/timeduration_fwd.hpp>
+
+struct SJob {
+    const timeduration::CTimePeriod *m_pTimeout = nullptr;
+};
+
+bool HasTimeout(const SJob &Job) {
+    return Job.m_pTimeout != nullptr;
+}
@@ -0,0 +1,31 @@
+# Compiles each source REPEAT times and prints the mean wall time per translation unit.
+#
+# Usage: cmake -DCOMPILER=... -DINCLUDE_DIR=... -DOUTPUT_DIR=... -DSOURCES="a.cpp;b.cpp"
+#              [-DFLAGS="-std=c++20;-O2"] [-DREPEAT=10] -P measure.cmake
+
+if(NOT DEFINED REPEAT)
+    set(REPEAT 10)
+endif()
+if(NOT DEFINED FLAGS)
+    set(FLAGS -std=c++20 -O2)
+endif()
+
+foreach(source ${SOURCES})
+    get_filename_component(name ${source} NAME_WE)
+    set(object ${OUTPUT_DIR}/${name}.o)
+
+    string(TIMESTAMP start "%s%f")
+    foreach(i RANGE 1 ${REPEAT})
+        execute_process(
+                COMMAND ${COMPILER} ${FLAGS} -I${INCLUDE_DIR} -c ${source} -o ${object}
+                RESULT_VARIABLE result
+        )
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "Failed to compile ${source}")
+        endif()
+    endforeach()
+    string(TIMESTAMP end "%s%f")
+
+    math(EXPR mean "(${end} - ${start}) / ${REPEAT} / 1000")
+    message(STATUS "${name}.cpp: ${mean} ms per TU")
+endforeach()
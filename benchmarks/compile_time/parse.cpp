@@ -0,0 +1,10 @@
+// Config loader
+#include <timeduration/core.hpp>
+#include <timeduration/parse.hpp>
+
+timeduration::CTimePeriod LoadTimeout(const std::string_view Text) {
+    std::chrono::seconds Value{0};
+    if (timeduration::CTimePeriod::TryParse(Text, Value))
+        return timeduration::CTimePeriod(Value);
+    return timeduration::CTimePeriod(Text);
+}
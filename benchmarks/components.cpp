@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/timeduration.hpp>
+
+#include <chrono>
+
+using namespace timeduration;
+
+namespace {
+    constexpr const char *NORMALIZED = "2d 5h 30m 15s";
+    constexpr const char *UNNORMALIZED = "90m 1y 2mo 3d 4s";
+}
+
+// Map-based scanner, flatten, Validate
+static void BM_ConstructFromParse(benchmark::State &State) {
+    const char *pInput = State.range(0) ? NORMALIZED : UNNORMALIZED;
+    for (auto _: State)
+        benchmark::DoNotOptimize(CTimePeriod(CTimePeriod::Parse(pInput)));
+}
+BENCHMARK(BM_ConstructFromParse)->Arg(0)->Arg(1);
+
+// Goes through TryParseComponents
+static void BM_ConstructFromString(benchmark::State &State) {
+    const char *pInput = State.range(0) ? NORMALIZED : UNNORMALIZED;
+    for (auto _: State)
+        benchmark::DoNotOptimize(CTimePeriod(pInput));
+}
+BENCHMARK(BM_ConstructFromString)->Arg(0)->Arg(1);
+
+// Allocation-free scan into seconds, then Validate
+static void BM_ConstructFromTryParse(benchmark::State &State) {
+    const char *pInput = State.range(0) ? NORMALIZED : UNNORMALIZED;
+    for (auto _: State) {
+        std::chrono::seconds Value{0};
+        benchmark::DoNotOptimize(CTimePeriod::TryParse(pInput, Value));
+        benchmark::DoNotOptimize(CTimePeriod(Value));
+    }
+}
+BENCHMARK(BM_ConstructFromTryParse)->Arg(0)->Arg(1);
+
+// Allocation-free scan into components, Validate skipped when they are already normalized
+static void BM_ConstructFromComponents(benchmark::State &State) {
+    const char *pInput = State.range(0) ? NORMALIZED : UNNORMALIZED;
+    for (auto _: State) {
+        SParsedComponents Components;
+        benchmark::DoNotOptimize(CTimePeriod::TryParseComponents(pInput, Components));
+        benchmark::DoNotOptimize(CTimePeriod(Components));
+    }
+}
+BENCHMARK(BM_ConstructFromComponents)->Arg(0)->Arg(1);
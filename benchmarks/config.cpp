@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/config.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+
+using namespace timeduration;
+
+namespace {
+    constexpr size_t ENTRIES = 100000;
+
+    std::string SyntheticConfig(const size_t Entries, const uint32_t Seed) {
+        std::mt19937 Rng(7);
+        std::uniform_int_distribution<int> Dist(1, 59);
+        std::mt19937 Changes(Seed);
+        std::uniform_int_distribution<int> Percent(0, 99);
+        std::string Text;
+        for (size_t i = 0; i < Entries; ++i) {
+            int Hours = Dist(Rng);
+            // Seed 0 is the baseline, any other seed changes about 1% of the values
+            if (Seed != 0 && Percent(Changes) == 0)
+                Hours += 60;
+            Text += "service." + std::to_string(i) + ".timeout = " + std::to_string(Hours) + "h " +
+                    std::to_string(Dist(Rng)) + "m\n";
+        }
+        return Text;
+    }
+}
+
+// Baseline: parse the full text with Parse() and rebuild a map on every reload
+static void BM_ConfigFullReparse(benchmark::State &State) {
+    const std::string Text = SyntheticConfig(ENTRIES, 1);
+    for (auto _: State) {
+        std::map<std::string, CTimePeriod> Values;
+        for (size_t Start = 0; Start < Text.size();) {
+            const size_t End = Text.find('\n', Start);
+            const std::string_view Line(Text.data() + Start, End - Start);
+            const size_t Equals = Line.find('=');
+            Values.insert_or_assign(std::string(Line.substr(0, Equals - 1)), CTimePeriod(Line.substr(Equals + 2)));
+            Start = End + 1;
+        }
+        benchmark::DoNotOptimize(Values.size());
+    }
+    State.SetBytesProcessed(State.iterations() * Text.size());
+}
+BENCHMARK(BM_ConfigFullReparse)->Unit(benchmark::kMillisecond);
+
+// Incremental parser fed in 64 KiB chunks, as from a socket or file watcher
+static void BM_ConfigParserChunked(benchmark::State &State) {
+    const std::string Text = SyntheticConfig(ENTRIES, 1);
+    const std::string_view View(Text);
+    for (auto _: State) {
+        CConfigParser Parser;
+        int64_t Sum = 0;
+        for (size_t Offset = 0; Offset < View.size(); Offset += 65536)
+            for (const auto &Entry: Parser.Feed(View.substr(Offset, 65536)))
+                Sum += Entry.m_Value.duration().count();
+        for (const auto &Entry: Parser.Finish())
+            Sum += Entry.m_Value.duration().count();
+        benchmark::DoNotOptimize(Sum);
+    }
+    State.SetBytesProcessed(State.iterations() * Text.size());
+}
+BENCHMARK(BM_ConfigParserChunked)->Unit(benchmark::kMillisecond);
+
+// Reload where about 1% of the values changed since the previous load
+static void BM_ConfigDiffReload(benchmark::State &State) {
+    const std::string aTexts[2] = {SyntheticConfig(ENTRIES, 0), SyntheticConfig(ENTRIES, 1)};
+    CConfigDiff Diff;
+    for (const auto &Change: Diff.Feed(aTexts[0]))
+        benchmark::DoNotOptimize(Change.m_Value);
+    for (const auto &Change: Diff.Finish())
+        benchmark::DoNotOptimize(Change.m_Value);
+
+    size_t Next = 1;
+    size_t Changed = 0;
+    for (auto _: State) {
+        for (const auto &Change: Diff.Feed(aTexts[Next]))
+            Changed += Change.m_Kind == EConfigChange::CHANGED;
+        for (const auto &Change: Diff.Finish())
+            Changed += Change.m_Kind == EConfigChange::CHANGED;
+        Next ^= 1;
+    }
+    State.counters["changed_per_reload"] = static_cast<double>(Changed) / State.iterations();
+    State.SetBytesProcessed(State.iterations() * aTexts[1].size());
+}
+BENCHMARK(BM_ConfigDiffReload)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/display.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    // Dashboard-like values: mostly minutes to days, some longer
+    const std::vector<std::chrono::seconds> &Durations() {
+        static const std::vector<std::chrono::seconds> s_vDurations = [] {
+            std::mt19937_64 Rng(42);
+            std::uniform_int_distribution<int64_t> Distribution(0, 400 * 86400);
+            std::vector<std::chrono::seconds> vDurations(4096);
+            for (auto &Duration: vDurations)
+                Duration = std::chrono::seconds(Distribution(Rng) >> (Rng() % 16));
+            return vDurations;
+        }();
+        return s_vDurations;
+    }
+
+    void FormatAll(benchmark::State &State, const SDisplayOptions &Options) {
+        const auto &vDurations = Durations();
+        char Buffer[DISPLAY_MAX_LENGTH];
+        for (auto _: State) {
+            for (const auto Duration: vDurations)
+                benchmark::DoNotOptimize(FormatDisplay(Duration, Buffer, Options));
+            benchmark::ClobberMemory();
+        }
+        State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(vDurations.size()));
+    }
+}
+
+// The existing formatter, for reference
+static void BM_DisplayToString(benchmark::State &State) {
+    std::vector<CTimePeriod> vPeriods(Durations().begin(), Durations().end());
+    for (auto _: State) {
+        for (const auto &Period: vPeriods)
+            benchmark::DoNotOptimize(Period.toString());
+    }
+    State.SetItemsProcessed(State.iterations() * static_cast<int64_t>(vPeriods.size()));
+}
+BENCHMARK(BM_DisplayToString);
+
+static void BM_DisplayCompact(benchmark::State &State) {
+    FormatAll(State, {EDisplayStyle::COMPACT});
+}
+BENCHMARK(BM_DisplayCompact);
+
+static void BM_DisplayLong(benchmark::State &State) {
+    FormatAll(State, {EDisplayStyle::LONG});
+}
+BENCHMARK(BM_DisplayLong);
+
+static void BM_DisplayRounded(benchmark::State &State) {
+    FormatAll(State, {EDisplayStyle::COMPACT, 2});
+}
+BENCHMARK(BM_DisplayRounded);
+
+static void BM_DisplayClock(benchmark::State &State) {
+    FormatAll(State, {EDisplayStyle::CLOCK});
+}
+BENCHMARK(BM_DisplayClock);
+
+static void BM_DisplayCalendar(benchmark::State &State) {
+    FormatAll(State, {EDisplayStyle::COMPACT, 0, true});
+}
+BENCHMARK(BM_DisplayCalendar);
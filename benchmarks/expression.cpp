@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/expression.hpp>
+
+#include <array>
+#include <chrono>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    constexpr const char *SOURCE = "max(base / 2, 5m) + 3 * jitter - 15s";
+    const std::array<std::chrono::seconds, 2> VALUES{1h, 10s};
+}
+
+// Compiling on every use, what a config lookup without a cache would do
+static void BM_ExpressionCompileEach(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(CExpression::Compile(SOURCE).Evaluate(VALUES));
+}
+BENCHMARK(BM_ExpressionCompileEach);
+
+static void BM_ExpressionCached(benchmark::State &State) {
+    CExpressionCache Cache;
+    for (auto _: State)
+        benchmark::DoNotOptimize(Cache.Get(SOURCE)->Evaluate(VALUES));
+}
+BENCHMARK(BM_ExpressionCached);
+
+// Compile once, evaluate many
+static void BM_ExpressionEvaluate(benchmark::State &State) {
+    const CExpression Expression = CExpression::Compile(SOURCE);
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        benchmark::DoNotOptimize(Expression.TryEvaluate(Out, VALUES));
+        benchmark::DoNotOptimize(Out);
+    }
+}
+BENCHMARK(BM_ExpressionEvaluate);
+
+// Constant expressions are folded at compile time
+static void BM_ExpressionEvaluateFolded(benchmark::State &State) {
+    const CExpression Expression = CExpression::Compile("2h - 15m");
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        benchmark::DoNotOptimize(Expression.TryEvaluate(Out));
+        benchmark::DoNotOptimize(Out);
+    }
+}
+BENCHMARK(BM_ExpressionEvaluateFolded);
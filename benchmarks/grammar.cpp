@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/grammar.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    // Equivalent durations spelled in each grammar
+    const std::vector<std::string> s_NativeInputs = {"30s", "5m", "2h", "1h 30m", "2h 30m 15s", "45m 10s"};
+    const std::vector<std::string> s_GoInputs = {"30s", "5m", "2h", "1h30m", "2h30m15s", "45m10s"};
+    const std::vector<std::string> s_GoFractionInputs = {"0.5m", "1.5h", "2.25h", "250ms", "-5m", "1.000001s"};
+    const std::vector<std::string> s_PrometheusInputs = {"30s", "5m", "2h", "1h30m", "2h30m15s", "45m10s"};
+
+    template<typename GrammarT>
+    void RunGrammar(benchmark::State &State, const std::vector<std::string> &Inputs) {
+        typename GrammarT::Duration Out{0};
+        for (auto _: State) {
+            for (const auto &Input: Inputs)
+                benchmark::DoNotOptimize(ParseWithGrammar<GrammarT>(Input, Out));
+        }
+        State.SetItemsProcessed(State.iterations() * Inputs.size());
+    }
+}
+
+static void BM_NativeGrammar(benchmark::State &State) {
+    RunGrammar<CNativeGrammar>(State, s_NativeInputs);
+}
+BENCHMARK(BM_NativeGrammar);
+
+static void BM_GoGrammar(benchmark::State &State) {
+    RunGrammar<CGoGrammar>(State, s_GoInputs);
+}
+BENCHMARK(BM_GoGrammar);
+
+static void BM_GoGrammarFractions(benchmark::State &State) {
+    RunGrammar<CGoGrammar>(State, s_GoFractionInputs);
+}
+BENCHMARK(BM_GoGrammarFractions);
+
+static void BM_PrometheusGrammar(benchmark::State &State) {
+    RunGrammar<CPrometheusGrammar>(State, s_PrometheusInputs);
+}
+BENCHMARK(BM_PrometheusGrammar);
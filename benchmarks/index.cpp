@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/index.hpp>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    // Timeouts between 1s and 1d, uniformly spread
+    std::vector<CDurationIndex<uint32_t>::Entry> MakeEntries(const size_t Size) {
+        std::mt19937_64 Rng(42);
+        std::uniform_int_distribution<int64_t> Seconds(1, 86400);
+        std::vector<CDurationIndex<uint32_t>::Entry> vEntries(Size);
+        for (size_t i = 0; i < Size; ++i)
+            vEntries[i] = {std::chrono::seconds(Seconds(Rng)), static_cast<uint32_t>(i)};
+        return vEntries;
+    }
+
+    std::multimap<CTimePeriod, uint32_t> MakeMultimap(const std::vector<CDurationIndex<uint32_t>::Entry> &vEntries) {
+        std::multimap<CTimePeriod, uint32_t> Map;
+        for (const auto &[Key, Value]: vEntries)
+            Map.emplace(CTimePeriod(Key), Value);
+        return Map;
+    }
+
+    // Random [from, from + 5m) windows
+    std::vector<int64_t> MakeQueries() {
+        std::mt19937_64 Rng(7);
+        std::uniform_int_distribution<int64_t> Seconds(1, 86400);
+        std::vector<int64_t> vQueries(4096);
+        for (auto &Query: vQueries)
+            Query = Seconds(Rng);
+        return vQueries;
+    }
+
+    constexpr int64_t WINDOW = 300;
+}
+
+static void BM_IndexBulkLoad(benchmark::State &State) {
+    const auto vEntries = MakeEntries(static_cast<size_t>(State.range(0)));
+    for (auto _: State) {
+        CDurationIndex<uint32_t> Index(vEntries);
+        benchmark::DoNotOptimize(Index.size());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_IndexBulkLoad)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_MultimapBulkLoad(benchmark::State &State) {
+    const auto vEntries = MakeEntries(static_cast<size_t>(State.range(0)));
+    for (auto _: State) {
+        auto Map = MakeMultimap(vEntries);
+        benchmark::DoNotOptimize(Map.size());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_MultimapBulkLoad)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_IndexCountInRange(benchmark::State &State) {
+    const CDurationIndex<uint32_t> Index(MakeEntries(static_cast<size_t>(State.range(0))));
+    const auto vQueries = MakeQueries();
+    size_t i = 0;
+    for (auto _: State) {
+        const int64_t From = vQueries[i++ & 4095];
+        benchmark::DoNotOptimize(Index.CountInRange(std::chrono::seconds(From), std::chrono::seconds(From + WINDOW)));
+    }
+}
+BENCHMARK(BM_IndexCountInRange)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 23);
+
+static void BM_MultimapCountInRange(benchmark::State &State) {
+    const auto Map = MakeMultimap(MakeEntries(static_cast<size_t>(State.range(0))));
+    const auto vQueries = MakeQueries();
+    size_t i = 0;
+    for (auto _: State) {
+        const int64_t From = vQueries[i++ & 4095];
+        const CTimePeriod Lower{std::chrono::seconds(From)};
+        const CTimePeriod Upper{std::chrono::seconds(From + WINDOW)};
+        benchmark::DoNotOptimize(std::distance(Map.lower_bound(Lower), Map.lower_bound(Upper)));
+    }
+}
+BENCHMARK(BM_MultimapCountInRange)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_IndexIterateRange(benchmark::State &State) {
+    const CDurationIndex<uint32_t> Index(MakeEntries(static_cast<size_t>(State.range(0))));
+    const auto vQueries = MakeQueries();
+    size_t i = 0;
+    for (auto _: State) {
+        const int64_t From = vQueries[i++ & 4095];
+        uint64_t Sum = 0;
+        Index.ForEachInRange(std::chrono::seconds(From), std::chrono::seconds(From + WINDOW),
+                             [&Sum](std::chrono::seconds, const uint32_t Value) { Sum += Value; });
+        benchmark::DoNotOptimize(Sum);
+    }
+}
+BENCHMARK(BM_IndexIterateRange)->Arg(1 << 20);
+
+static void BM_MultimapIterateRange(benchmark::State &State) {
+    const auto Map = MakeMultimap(MakeEntries(static_cast<size_t>(State.range(0))));
+    const auto vQueries = MakeQueries();
+    size_t i = 0;
+    for (auto _: State) {
+        const int64_t From = vQueries[i++ & 4095];
+        uint64_t Sum = 0;
+        const auto End = Map.lower_bound(CTimePeriod(std::chrono::seconds(From + WINDOW)));
+        for (auto It = Map.lower_bound(CTimePeriod(std::chrono::seconds(From))); It != End; ++It)
+            Sum += It->second;
+        benchmark::DoNotOptimize(Sum);
+    }
+}
+BENCHMARK(BM_MultimapIterateRange)->Arg(1 << 20);
+
+static void BM_IndexInsert(benchmark::State &State) {
+    const auto vInserts = MakeEntries(1 << 16);
+    for (auto _: State) {
+        State.PauseTiming();
+        CDurationIndex<uint32_t> Index(MakeEntries(static_cast<size_t>(State.range(0))));
+        State.ResumeTiming();
+        for (const auto &[Key, Value]: vInserts)
+            Index.Insert(Key, Value);
+        benchmark::DoNotOptimize(Index.size());
+    }
+    State.SetItemsProcessed(State.iterations() * (1 << 16));
+}
+BENCHMARK(BM_IndexInsert)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+static void BM_MultimapInsert(benchmark::State &State) {
+    const auto vInserts = MakeEntries(1 << 16);
+    for (auto _: State) {
+        State.PauseTiming();
+        auto Map = MakeMultimap(MakeEntries(static_cast<size_t>(State.range(0))));
+        State.ResumeTiming();
+        for (const auto &[Key, Value]: vInserts)
+            Map.emplace(CTimePeriod(Key), Value);
+        benchmark::DoNotOptimize(Map.size());
+        State.PauseTiming();
+        Map.clear();
+        State.ResumeTiming();
+    }
+    State.SetItemsProcessed(State.iterations() * (1 << 16));
+}
+BENCHMARK(BM_MultimapInsert)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/timeduration.hpp>
+
+// Built once plain and once with TIMEDURATION_ENABLE_INSTRUMENTATION; compare the two runs
+
+using namespace timeduration;
+
+namespace {
+    const char *InstrumentationLabel() {
+        return instrumentation::ENABLED ? "instrumented" : "plain";
+    }
+}
+
+static void BM_InstrumentedParse(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(CTimePeriod::Parse("2h 30m 15s"));
+    State.SetLabel(InstrumentationLabel());
+}
+BENCHMARK(BM_InstrumentedParse);
+
+static void BM_InstrumentedTryParse(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State)
+        benchmark::DoNotOptimize(CTimePeriod::TryParse("2h 30m 15s", Out));
+    State.SetLabel(InstrumentationLabel());
+}
+BENCHMARK(BM_InstrumentedTryParse);
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/iso8601.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    // The same durations in both grammars so per-input cost is comparable
+    const std::vector<std::string> s_NativeInputs = {
+        "30s", "5m", "2h", "1d", "1h 30m", "2h 30m 15s", "1d 2h 30m", "7d", "45m 10s", "3h 15m",
+    };
+    const std::vector<std::string> s_IsoInputs = {
+        "PT30S", "PT5M", "PT2H", "P1D", "PT1H30M", "PT2H30M15S", "P1DT2H30M", "P7D", "PT45M10S", "PT3H15M",
+    };
+}
+
+static void BM_NativeParse(benchmark::State &State) {
+    for (auto _: State) {
+        for (const auto &Input: s_NativeInputs)
+            benchmark::DoNotOptimize(CTimePeriod::Parse(Input));
+    }
+    State.SetItemsProcessed(State.iterations() * s_NativeInputs.size());
+}
+BENCHMARK(BM_NativeParse);
+
+static void BM_NativeTryParse(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        for (const auto &Input: s_NativeInputs)
+            benchmark::DoNotOptimize(CTimePeriod::TryParse(Input, Out));
+    }
+    State.SetItemsProcessed(State.iterations() * s_NativeInputs.size());
+}
+BENCHMARK(BM_NativeTryParse);
+
+static void BM_Iso8601Parse(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        for (const auto &Input: s_IsoInputs)
+            benchmark::DoNotOptimize(ParseIso8601(Input, Out));
+    }
+    State.SetItemsProcessed(State.iterations() * s_IsoInputs.size());
+}
+BENCHMARK(BM_Iso8601Parse);
+
+static void BM_TryParseDurationMixed(benchmark::State &State) {
+    std::chrono::seconds Out{0};
+    for (auto _: State) {
+        for (size_t i = 0; i < s_IsoInputs.size(); ++i) {
+            benchmark::DoNotOptimize(TryParseDuration(s_IsoInputs[i], Out));
+            benchmark::DoNotOptimize(TryParseDuration(s_NativeInputs[i], Out));
+        }
+    }
+    State.SetItemsProcessed(State.iterations() * s_IsoInputs.size() * 2);
+}
+BENCHMARK(BM_TryParseDurationMixed);
+
+static void BM_NativeToString(benchmark::State &State) {
+    const CTimePeriod Period("1d 2h 30m 15s");
+    for (auto _: State)
+        benchmark::DoNotOptimize(Period.toString());
+}
+BENCHMARK(BM_NativeToString);
+
+static void BM_Iso8601Format(benchmark::State &State) {
+    const CTimePeriod Period("1d 2h 30m 15s");
+    char Buffer[ISO8601_MAX_LENGTH];
+    for (auto _: State) {
+        benchmark::DoNotOptimize(FormatIso8601(Period.duration(), Buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Iso8601Format);
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/timeduration.hpp>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+using namespace timeduration;
+
+namespace {
+    std::string Repeat(const std::string_view Pattern, const size_t Size) {
+        std::string Input;
+        Input.reserve(Size + Pattern.size());
+        while (Input.size() < Size)
+            Input += Pattern;
+        return Input;
+    }
+
+    // Adversarial shapes: 0 digits, 1 letters, 2 "1x" (unknown units), 3 "1s", 4 zeros
+    std::string Adversarial(const int64_t Shape, const size_t Size) {
+        switch (Shape) {
+            case 0: return Repeat("9", Size);
+            case 1: return Repeat("a", Size);
+            case 2: return Repeat("1x", Size);
+            case 3: return Repeat("1s", Size);
+            default: return Repeat("0", Size);
+        }
+    }
+
+    // Cycles per input byte, derived from the wall time of the whole loop and the nominal CPU frequency
+    class CCyclesPerByte final {
+        benchmark::State &m_State;
+        const size_t m_Bytes;
+        const std::chrono::steady_clock::time_point m_Start = std::chrono::steady_clock::now();
+
+    public:
+        CCyclesPerByte(benchmark::State &State, const size_t Bytes) : m_State(State), m_Bytes(Bytes) {}
+
+        ~CCyclesPerByte() {
+            const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - m_Start;
+            const double Bytes = static_cast<double>(m_Bytes) * static_cast<double>(m_State.iterations());
+            m_State.counters["cycles_per_byte"] = Elapsed.count() * benchmark::CPUInfo::Get().cycles_per_second / Bytes;
+            m_State.SetBytesProcessed(static_cast<int64_t>(Bytes));
+        }
+    };
+}
+
+static void BM_ParseAdversarial(benchmark::State &State) {
+    const std::string Input = Adversarial(State.range(0), 1 << 20);
+    const CCyclesPerByte Report(State, Input.size());
+    for (auto _: State) {
+        try {
+            benchmark::DoNotOptimize(CTimePeriod::Parse(Input));
+        } catch (const std::out_of_range &) {
+        }
+    }
+}
+BENCHMARK(BM_ParseAdversarial)->DenseRange(0, 4)->Unit(benchmark::kMicrosecond);
+
+static void BM_TryParseAdversarial(benchmark::State &State) {
+    const std::string Input = Adversarial(State.range(0), 1 << 20);
+    const CCyclesPerByte Report(State, Input.size());
+    for (auto _: State) {
+        std::chrono::seconds Value{0};
+        benchmark::DoNotOptimize(CTimePeriod::TryParse(Input, Value));
+    }
+}
+BENCHMARK(BM_TryParseAdversarial)->DenseRange(0, 4)->Unit(benchmark::kMicrosecond);
+
+// Same megabyte inputs under the untrusted preset: rejected before the first byte is read
+static void BM_TryParseAdversarialLimited(benchmark::State &State) {
+    const std::string Input = Adversarial(State.range(0), 1 << 20);
+    for (auto _: State) {
+        std::chrono::seconds Value{0};
+        benchmark::DoNotOptimize(CTimePeriod::TryParse(Input, Value, UNTRUSTED_INPUT_LIMITS));
+    }
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_TryParseAdversarialLimited)->DenseRange(0, 4);
+
+// Largest input the preset accepts, i.e. the worst case it still has to scan
+static void BM_TryParseLimitedWorstCase(benchmark::State &State) {
+    const std::string Input = Adversarial(State.range(0), UNTRUSTED_INPUT_LIMITS.m_MaxLength).substr(
+        0, UNTRUSTED_INPUT_LIMITS.m_MaxLength);
+    const CCyclesPerByte Report(State, Input.size());
+    for (auto _: State) {
+        std::chrono::seconds Value{0};
+        benchmark::DoNotOptimize(CTimePeriod::TryParse(Input, Value, UNTRUSTED_INPUT_LIMITS));
+    }
+}
+BENCHMARK(BM_TryParseLimitedWorstCase)->DenseRange(0, 4);
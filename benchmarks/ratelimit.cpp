@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/ratelimit.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+using namespace timeduration;
+
+namespace {
+    // Generous enough that permits are always available, so every acquire updates the state
+    constexpr const char *SPEC = "1000000000 per 1s";
+
+    // The pattern being replaced: a token bucket of doubles behind a mutex
+    class CLockedBucket final {
+        std::mutex m_Mutex;
+        double m_Tokens;
+        double m_Capacity;
+        double m_RatePerSecond;
+        std::chrono::steady_clock::time_point m_Last = std::chrono::steady_clock::now();
+
+    public:
+        explicit CLockedBucket(const SRateLimit &Limit) : m_Tokens(static_cast<double>(Limit.m_Count)),
+            m_Capacity(static_cast<double>(Limit.m_Count)),
+            m_RatePerSecond(static_cast<double>(Limit.m_Count) / static_cast<double>(Limit.m_Period.duration().count())) {
+        }
+
+        bool TryAcquire() {
+            const auto Now = std::chrono::steady_clock::now();
+            const std::lock_guard Lock(m_Mutex);
+            const std::chrono::duration<double> Elapsed = Now - m_Last;
+            m_Last = Now;
+            m_Tokens = std::min(m_Capacity, m_Tokens + Elapsed.count() * m_RatePerSecond);
+            if (m_Tokens < 1.0)
+                return false;
+            m_Tokens -= 1.0;
+            return true;
+        }
+    };
+
+    CLockedBucket s_Locked(ParseRateLimit(SPEC));
+    CRateLimiter s_Limiter(SPEC);
+    CRateLimiter s_Exhausted("1 per 1h");
+}
+
+static void BM_RateLimitMutex(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(s_Locked.TryAcquire());
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_RateLimitMutex)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_RateLimitGcra(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(s_Limiter.TryAcquire());
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_RateLimitGcra)->ThreadRange(1, 64)->UseRealTime();
+
+// Over the limit: a rejection is a load and a compare, no CAS
+static void BM_RateLimitGcraRejected(benchmark::State &State) {
+    for (auto _: State)
+        benchmark::DoNotOptimize(s_Exhausted.TryAcquire());
+    State.SetItemsProcessed(State.iterations());
+}
+BENCHMARK(BM_RateLimitGcraRejected)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ParseRateLimit(benchmark::State &State) {
+    SRateLimit Limit;
+    for (auto _: State)
+        benchmark::DoNotOptimize(TryParseRateLimit("100 per 1m", Limit));
+}
+BENCHMARK(BM_ParseRateLimit);
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/sort.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    std::vector<int64_t> RandomTotals(const size_t Count) {
+        std::mt19937_64 Rng(1337);
+        // Mostly sub-day durations with a long tail, like real ranking input
+        std::uniform_int_distribution<int64_t> Dist(0, 30 * 86400);
+        std::vector<int64_t> Totals(Count);
+        for (auto &Total: Totals)
+            Total = Dist(Rng);
+        return Totals;
+    }
+
+    std::vector<CTimePeriod> RandomPeriods(const size_t Count) {
+        std::vector<CTimePeriod> Periods;
+        Periods.reserve(Count);
+        for (const auto Total: RandomTotals(Count))
+            Periods.emplace_back(std::chrono::seconds(Total));
+        return Periods;
+    }
+}
+
+static void BM_StdSortTotals(benchmark::State &State) {
+    const auto Source = RandomTotals(State.range(0));
+    for (auto _: State) {
+        State.PauseTiming();
+        auto Totals = Source;
+        State.ResumeTiming();
+        std::sort(Totals.begin(), Totals.end());
+        benchmark::DoNotOptimize(Totals.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_StdSortTotals)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_SortDurationsTotals(benchmark::State &State) {
+    const auto Source = RandomTotals(State.range(0));
+    for (auto _: State) {
+        State.PauseTiming();
+        auto Totals = Source;
+        State.ResumeTiming();
+        SortDurations(Totals);
+        benchmark::DoNotOptimize(Totals.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_SortDurationsTotals)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_StdSortPeriods(benchmark::State &State) {
+    const auto Source = RandomPeriods(State.range(0));
+    for (auto _: State) {
+        State.PauseTiming();
+        auto Periods = Source;
+        State.ResumeTiming();
+        std::sort(Periods.begin(), Periods.end());
+        benchmark::DoNotOptimize(Periods.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_StdSortPeriods)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_SortDurationsPeriods(benchmark::State &State) {
+    const auto Source = RandomPeriods(State.range(0));
+    for (auto _: State) {
+        State.PauseTiming();
+        auto Periods = Source;
+        State.ResumeTiming();
+        SortDurations(Periods);
+        benchmark::DoNotOptimize(Periods.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_SortDurationsPeriods)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_StdPartialSortTop100(benchmark::State &State) {
+    const auto Totals = RandomTotals(State.range(0));
+    std::vector<size_t> Indices(Totals.size());
+    for (auto _: State) {
+        for (size_t i = 0; i < Indices.size(); ++i)
+            Indices[i] = i;
+        std::partial_sort(Indices.begin(), Indices.begin() + 100, Indices.end(),
+                          [&](const size_t Lhs, const size_t Rhs) { return Totals[Lhs] > Totals[Rhs]; });
+        benchmark::DoNotOptimize(Indices.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_StdPartialSortTop100)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void BM_TopK100(benchmark::State &State) {
+    const auto Totals = RandomTotals(State.range(0));
+    std::vector<size_t> Out(100);
+    for (auto _: State) {
+        benchmark::DoNotOptimize(TopK(Totals, Out));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_TopK100)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
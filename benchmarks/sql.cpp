@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/sql.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    std::vector<CTimePeriod> RandomPeriods(const size_t Count) {
+        std::mt19937_64 Rng(7);
+        std::uniform_int_distribution<int64_t> Dist(0, 90 * 86400);
+        std::vector<CTimePeriod> Periods;
+        Periods.reserve(Count);
+        for (size_t i = 0; i < Count; ++i)
+            Periods.emplace_back(std::chrono::seconds(Dist(Rng)));
+        return Periods;
+    }
+}
+
+// What the batch-insert generator does today: a temporary per value plus concatenation
+static void BM_SqlConcatenation(benchmark::State &State) {
+    const auto Periods = RandomPeriods(State.range(0));
+    for (auto _: State) {
+        std::string Sql;
+        for (size_t i = 0; i < Periods.size(); ++i) {
+            if (i != 0)
+                Sql += ", ";
+            Sql += Periods[i].asSqlInterval();
+        }
+        benchmark::DoNotOptimize(Sql.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_SqlConcatenation)->Arg(1000)->Arg(100000);
+
+static void BM_AppendSqlIntervals(benchmark::State &State) {
+    const auto Periods = RandomPeriods(State.range(0));
+    for (auto _: State) {
+        std::string Sql;
+        AppendSqlIntervals(Sql, Periods, ESqlDialect::GENERIC);
+        benchmark::DoNotOptimize(Sql.data());
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_AppendSqlIntervals)->Arg(1000)->Arg(100000);
+
+static void BM_WriteSqlIntervalsReusedBuffer(benchmark::State &State) {
+    const auto Periods = RandomPeriods(State.range(0));
+    std::vector<char> Buffer(Periods.size() * 40);
+    const auto Dialect = static_cast<ESqlDialect>(State.range(1));
+    for (auto _: State) {
+        benchmark::DoNotOptimize(WriteSqlIntervals(Buffer, Periods, Dialect));
+        benchmark::ClobberMemory();
+    }
+    State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_WriteSqlIntervalsReusedBuffer)
+    ->ArgsProduct({{1000, 100000}, {
+        static_cast<int64_t>(ESqlDialect::GENERIC), static_cast<int64_t>(ESqlDialect::POSTGRESQL),
+        static_cast<int64_t>(ESqlDialect::MYSQL), static_cast<int64_t>(ESqlDialect::CLICKHOUSE),
+        static_cast<int64_t>(ESqlDialect::SQLITE)
+    }});
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <timeduration/timeout.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <latch>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    constexpr int CONCURRENT_WAITS = 10000;
+
+    // Delays spread uniformly over 200 ms, as from many independent "30s"-style timeouts started at once
+    const std::vector<std::chrono::microseconds> &Delays() {
+        static const std::vector<std::chrono::microseconds> s_vDelays = [] {
+            std::mt19937_64 Rng(13);
+            std::vector<std::chrono::microseconds> vDelays(CONCURRENT_WAITS);
+            for (auto &Delay: vDelays)
+                Delay = std::chrono::microseconds(Rng() % 200000);
+            return vDelays;
+        }();
+        return s_vDelays;
+    }
+
+    double CpuMilliseconds(const std::clock_t Start) {
+        return 1000.0 * static_cast<double>(std::clock() - Start) / CLOCKS_PER_SEC;
+    }
+}
+
+// 10k concurrent waits on one CTimeoutService; Arg is the slack in milliseconds
+static void BM_TimeoutServiceWaits(benchmark::State &State) {
+    const auto Slack = std::chrono::milliseconds(State.range(0));
+    double CpuMs = 0;
+    double Wakeups = 0;
+    for (auto _: State) {
+        const std::clock_t Start = std::clock();
+        {
+            CTimeoutService Service(Slack);
+            std::latch Done(CONCURRENT_WAITS);
+            for (const auto Delay: Delays())
+                Service.Schedule(Delay, [&Done] { Done.count_down(); });
+            Done.wait();
+            Wakeups += static_cast<double>(Service.Stats().m_Wakeups);
+        }
+        CpuMs += CpuMilliseconds(Start);
+    }
+    State.counters["wakeups"] = benchmark::Counter(Wakeups, benchmark::Counter::kAvgIterations);
+    State.counters["cpu_ms"] = benchmark::Counter(CpuMs, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TimeoutServiceWaits)->Arg(0)->Arg(1)->Arg(10)->Arg(50)->Iterations(3)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// The pattern it replaces: one thread sleeping per wait, one wakeup each
+static void BM_ThreadPerWait(benchmark::State &State) {
+    double CpuMs = 0;
+    for (auto _: State) {
+        const std::clock_t Start = std::clock();
+        std::vector<std::thread> vThreads;
+        vThreads.reserve(Delays().size());
+        for (const auto Delay: Delays())
+            vThreads.emplace_back([Delay] { std::this_thread::sleep_for(Delay); });
+        for (auto &Thread: vThreads)
+            Thread.join();
+        CpuMs += CpuMilliseconds(Start);
+    }
+    State.counters["wakeups"] = benchmark::Counter(CONCURRENT_WAITS);
+    State.counters["cpu_ms"] = benchmark::Counter(CpuMs, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ThreadPerWait)->Iterations(3)->UseRealTime()->Unit(benchmark::kMillisecond);
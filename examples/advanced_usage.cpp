@@ -1,8 +1,11 @@
 #include <timeduration/timeduration.hpp>
+#include <timeduration/sort.hpp>
+#include <timeduration/timeout.hpp>
 #include <iostream>
 #include <vector>
 #include <chrono>
 #include <thread>
+#include <latch>
 #include <fstream>
 #include <sstream>
 #include <map>
@@ -169,6 +172,22 @@ void demonstrate_sorting_ranking() {
                   << proc.runtime.duration().count() << std::endl;
     }
 
+    // Select the longest runtimes without sorting the whole list
+    std::vector<CTimePeriod> runtimes;
+    for (const auto& proc : processes) {
+        runtimes.push_back(proc.runtime);
+    }
+
+    std::vector<size_t> top(3);
+    const size_t top_count = TopK(runtimes, top);
+
+    std::cout << "\nTop " << top_count << " longest (TopK):" << std::endl;
+    for (size_t i = 0; i < top_count; ++i) {
+        const auto& proc = processes[top[i]];
+        std::cout << "  " << std::setw(20) << proc.name
+                  << proc.runtime.toString() << std::endl;
+    }
+
     // Sort by runtime (longest first)
     std::sort(processes.begin(), processes.end(),
         [](const Process& a, const Process& b) {
@@ -259,6 +278,33 @@ void demonstrate_threading_integration() {
 
     std::cout << "Expected total delay: " << expected_total.toString() << std::endl;
     std::cout << "Actual elapsed time: " << total_elapsed.count() << "s" << std::endl;
+
+    // Many concurrent waits share one waiter thread instead of sleeping a thread each;
+    // deadlines within the same 100ms window are served by a single wakeup
+    std::cout << "\nShared timeout service (100ms slack):" << std::endl;
+    CTimeoutService service(std::chrono::milliseconds(100));
+    std::latch done(3);
+    for (const char* delay : {"1s", "1s", "2s"}) {
+        service.Schedule(CTimePeriod(delay), [&done, delay] {
+            std::cout << "  timeout after " << delay << std::endl;
+            done.count_down();
+        });
+    }
+    auto cancelled = service.Schedule(CTimePeriod("1h"), [] { std::cout << "  never printed" << std::endl; });
+    service.Cancel(cancelled);
+    done.wait();
+
+    auto stats = service.Stats();
+    std::cout << "  " << stats.m_Fired << " timeouts in " << stats.m_Batches << " wakeup batches, "
+              << stats.m_Cancelled << " cancelled" << std::endl;
+
+    // Retry delays built from parsed durations
+    CBackoff backoff("1s", "1m");
+    std::cout << "\nRetry schedule:";
+    for (int attempt = 0; attempt < 8; ++attempt) {
+        std::cout << " " << backoff.Next().toString();
+    }
+    std::cout << std::endl;
 }
 
 // Example 5: SQL Query Generation
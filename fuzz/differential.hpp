@@ -0,0 +1,187 @@
+#ifndef TIMEDURATION_FUZZ_DIFFERENTIAL_HPP
+#define TIMEDURATION_FUZZ_DIFFERENTIAL_HPP
+
+#include "reference_scanner.hpp"
+
+#include <timeduration/grammar.hpp>
+#include <timeduration/iso8601.hpp>
+#include <timeduration/timeduration.hpp>
+
+#if defined(TIMEDURATION_FUZZ_C_API)
+#include <timeduration/timeduration_c.h>
+#endif
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * Differential check of every parse implementation against the reference scanner.
+ *
+ * Shared by the libFuzzer target and the standalone driver. To cover a new parse path,
+ * add it to IMPLEMENTATIONS below.
+ */
+namespace timeduration::fuzz {
+
+using reference::EOutcome;
+using reference::SResult;
+
+struct SImplementation {
+    const char *m_pName;
+    // Returns the outcome in reference terms, both overflow kinds as TOTAL_OVERFLOW
+    SResult (*m_Parse)(std::string_view Input);
+    bool m_SkipsIso8601; // dispatches ISO 8601 input to another grammar
+};
+
+namespace detail {
+    // Paths that throw std::out_of_range for a too long number and for a total that overflows alike
+    template<std::chrono::seconds (*ParseFn)(std::string_view)>
+    SResult Throwing(const std::string_view Input) {
+        try {
+            return {EOutcome::OK, ParseFn(Input).count()};
+        } catch (const std::out_of_range &) {
+            return {EOutcome::TOTAL_OVERFLOW, 0};
+        }
+    }
+
+    inline std::chrono::seconds ParseDefault(const std::string_view Input) {
+        return CTimePeriod::Parse(Input);
+    }
+
+    inline std::chrono::seconds ParsePmr(const std::string_view Input) {
+        std::byte aBuffer[4096];
+        std::pmr::monotonic_buffer_resource Arena(aBuffer, sizeof(aBuffer));
+        return CTimePeriod::Parse(Input, &Arena);
+    }
+
+    inline std::chrono::seconds ParseConstructor(const std::string_view Input) {
+        return CTimePeriod(Input).duration();
+    }
+
+    // Non-throwing paths report any overflow as false; both overflow outcomes are equivalent there
+    inline SResult FromBool(const bool Success, const std::chrono::seconds Value) {
+        return Success ? SResult{EOutcome::OK, Value.count()} : SResult{EOutcome::TOTAL_OVERFLOW, 0};
+    }
+
+    inline SResult TryParse(const std::string_view Input) {
+        std::chrono::seconds Value{0};
+        const bool Success = CTimePeriod::TryParse(Input, Value);
+        return FromBool(Success, Value);
+    }
+
+    inline SResult TryParseComponents(const std::string_view Input) {
+        SParsedComponents Components;
+        const bool Success = CTimePeriod::TryParseComponents(Input, Components);
+        return FromBool(Success, Success ? CTimePeriod(Components).duration() : std::chrono::seconds(0));
+    }
+
+    inline SResult NativeGrammar(const std::string_view Input) {
+        std::chrono::seconds Value{0};
+        const bool Success = ParseWithGrammar<CNativeGrammar>(Input, Value);
+        return FromBool(Success, Value);
+    }
+
+    inline SResult UnifiedDuration(const std::string_view Input) {
+        std::chrono::seconds Value{0};
+        const bool Success = TryParseDuration(Input, Value);
+        return FromBool(Success, Value);
+    }
+
+#if defined(TIMEDURATION_FUZZ_C_API)
+    inline SResult CApi(const std::string_view Input) {
+        int64_t Value = 0;
+        const td_status Status = td_parse(Input.data(), Input.size(), &Value);
+        return Status == TD_OK ? SResult{EOutcome::OK, Value} : SResult{EOutcome::TOTAL_OVERFLOW, 0};
+    }
+#endif
+} // namespace detail
+
+inline constexpr SImplementation IMPLEMENTATIONS[] = {
+    {"CTimePeriod::Parse", &detail::Throwing<&detail::ParseDefault>, false},
+    {"CTimePeriod::Parse(pmr)", &detail::Throwing<&detail::ParsePmr>, false},
+    {"CTimePeriod(string_view)", &detail::Throwing<&detail::ParseConstructor>, false},
+    {"CTimePeriod::TryParse", &detail::TryParse, false},
+    {"CTimePeriod::TryParseComponents", &detail::TryParseComponents, false},
+    {"ParseWithGrammar<CNativeGrammar>", &detail::NativeGrammar, false},
+    {"TryParseDuration", &detail::UnifiedDuration, true},
+#if defined(TIMEDURATION_FUZZ_C_API)
+    {"td_parse", &detail::CApi, false},
+#endif
+};
+
+inline constexpr size_t NUM_IMPLEMENTATIONS = std::size(IMPLEMENTATIONS);
+
+/**
+ * @brief Slowest input seen per implementation
+ */
+struct SLatency {
+    uint64_t m_WorstNanoseconds = 0;
+    size_t m_WorstLength = 0;
+    double m_WorstNanosecondsPerByte = 0;
+    size_t m_WorstPerByteLength = 0;
+};
+
+/**
+ * @brief Result of one differential check
+ */
+struct SMismatch {
+    const char *m_pImplementation = nullptr; // nullptr if all implementations agree
+    SResult m_Expected;
+    SResult m_Actual;
+};
+
+/**
+ * @brief Run Input through the reference and every implementation
+ *
+ * @param Input Arbitrary bytes
+ * @param aLatency Per-implementation worst case, updated with this input's timings
+ * @param MinBytesForPerByte Inputs shorter than this do not count toward ns/byte (timer noise)
+ * @return SMismatch First disagreement, m_pImplementation is nullptr if there is none
+ */
+inline SMismatch CheckInput(const std::string_view Input, std::array<SLatency, NUM_IMPLEMENTATIONS> &aLatency,
+                            const size_t MinBytesForPerByte = 1024) {
+    const SResult Expected = reference::Parse(Input);
+    const bool Iso8601 = IsIso8601Duration(Input);
+
+    for (size_t i = 0; i < NUM_IMPLEMENTATIONS; ++i) {
+        const auto &Implementation = IMPLEMENTATIONS[i];
+        if (Iso8601 && Implementation.m_SkipsIso8601)
+            continue;
+
+        const auto Start = std::chrono::steady_clock::now();
+        const SResult Actual = Implementation.m_Parse(Input);
+        const auto Elapsed = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Start).count());
+
+        auto &Latency = aLatency[i];
+        if (Elapsed > Latency.m_WorstNanoseconds) {
+            Latency.m_WorstNanoseconds = Elapsed;
+            Latency.m_WorstLength = Input.size();
+        }
+        if (Input.size() >= MinBytesForPerByte) {
+            const double PerByte = static_cast<double>(Elapsed) / static_cast<double>(Input.size());
+            if (PerByte > Latency.m_WorstNanosecondsPerByte) {
+                Latency.m_WorstNanosecondsPerByte = PerByte;
+                Latency.m_WorstPerByteLength = Input.size();
+            }
+        }
+
+        // Implementations report both overflow kinds as one outcome
+        SResult Compared = Expected;
+        if (Compared.m_Outcome == EOutcome::NUMBER_OVERFLOW)
+            Compared.m_Outcome = EOutcome::TOTAL_OVERFLOW;
+        if (Actual.m_Outcome != Compared.m_Outcome ||
+            (Actual.m_Outcome == EOutcome::OK && Actual.m_Seconds != Compared.m_Seconds))
+            return {Implementation.m_pName, Expected, Actual};
+    }
+    return {};
+}
+
+} // namespace timeduration::fuzz
+
+#endif // TIMEDURATION_FUZZ_DIFFERENTIAL_HPP
@@ -0,0 +1,200 @@
+// Standalone differential driver: random and pathological inputs, plus corpus replay
+//
+// timeduration_fuzz_driver [--runs=N] [--seed=N] [--max-length=N] [--pathological-size=BYTES]
+//                          [--max-ns-per-byte=N] [corpus files or directories...]
+#include "differential.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace timeduration::fuzz;
+
+namespace {
+    struct SOptions {
+        size_t m_Runs = 100000;
+        uint64_t m_Seed = 1;
+        size_t m_MaxLength = 64;
+        size_t m_PathologicalSize = 1 << 20;
+        double m_MaxNanosecondsPerByte = 0; // 0: report only
+        std::vector<std::string> m_vCorpus;
+    };
+
+    bool ParseOption(const char *pArg, const char *pName, const char *&pValue) {
+        const size_t Length = std::strlen(pName);
+        if (std::strncmp(pArg, pName, Length) != 0 || pArg[Length] != '=')
+            return false;
+        pValue = pArg + Length + 1;
+        return true;
+    }
+
+    SOptions ParseOptions(const int argc, char **argv) {
+        SOptions Options;
+        for (int i = 1; i < argc; ++i) {
+            const char *pValue = nullptr;
+            if (ParseOption(argv[i], "--runs", pValue))
+                Options.m_Runs = std::strtoull(pValue, nullptr, 10);
+            else if (ParseOption(argv[i], "--seed", pValue))
+                Options.m_Seed = std::strtoull(pValue, nullptr, 10);
+            else if (ParseOption(argv[i], "--max-length", pValue))
+                Options.m_MaxLength = std::strtoull(pValue, nullptr, 10);
+            else if (ParseOption(argv[i], "--pathological-size", pValue))
+                Options.m_PathologicalSize = std::strtoull(pValue, nullptr, 10);
+            else if (ParseOption(argv[i], "--max-ns-per-byte", pValue))
+                Options.m_MaxNanosecondsPerByte = std::strtod(pValue, nullptr);
+            else
+                Options.m_vCorpus.emplace_back(argv[i]);
+        }
+        return Options;
+    }
+
+    // Mostly well-formed fragments so that inputs reach deep into the grammar
+    std::string RandomInput(std::mt19937_64 &Rng, const size_t MaxLength) {
+        static constexpr const char *s_apFragments[] = {
+            "s", "seconds", "m", "minutes", "h", "hours", "d", "days", "mo", "months", "y", "years",
+            "H", "M", "x", "sec", "min", " ", "  ", "\t", ",", "-", "+", ".", "P", "T", "\xC2\xB5", "\xFF", "\0",
+            "0", "00", "9223372036854775807", "9223372036854775808", "99999999999999999999",
+        };
+        std::uniform_int_distribution<size_t> Length(0, MaxLength);
+        std::uniform_int_distribution<int> Kind(0, 9);
+        std::uniform_int_distribution<size_t> Fragment(0, std::size(s_apFragments) - 1);
+        std::uniform_int_distribution<int> Digits(1, 12);
+        std::uniform_int_distribution<int> Byte(0, 255);
+
+        std::string Input;
+        const size_t Target = Length(Rng);
+        while (Input.size() < Target) {
+            const int Choice = Kind(Rng);
+            if (Choice < 4) {
+                for (int i = Digits(Rng); i > 0; --i)
+                    Input += static_cast<char>('0' + Rng() % 10);
+            } else if (Choice < 9) {
+                const char *pFragment = s_apFragments[Fragment(Rng)];
+                Input.append(pFragment, *pFragment ? std::strlen(pFragment) : 1);
+            } else {
+                Input += static_cast<char>(Byte(Rng));
+            }
+        }
+        return Input;
+    }
+
+    std::vector<std::pair<std::string, std::string>> PathologicalInputs(const size_t Size) {
+        const auto Repeat = [Size](const std::string_view Pattern) {
+            std::string Input;
+            Input.reserve(Size + Pattern.size());
+            while (Input.size() < Size)
+                Input += Pattern;
+            return Input;
+        };
+        return {
+            {"digits", Repeat("9")},
+            {"zeros", Repeat("0")},
+            {"letters", Repeat("a")},
+            {"spaces", Repeat(" ")},
+            {"high bytes", Repeat("\xFF")},
+            {"number + long unit", "1" + Repeat("a")},
+            {"known units", Repeat("1s")},
+            {"long known units", Repeat("1seconds ")},
+            {"unknown units", Repeat("1x")},
+            {"bare numbers", Repeat("1 ")},
+        };
+    }
+
+    bool Check(const std::string_view Input, std::array<SLatency, NUM_IMPLEMENTATIONS> &aLatency) {
+        const auto Mismatch = CheckInput(Input, aLatency);
+        if (!Mismatch.m_pImplementation)
+            return true;
+
+        std::fprintf(stderr, "MISMATCH in %s\n  expected outcome %d, %lld s\n  actual   outcome %d, %lld s\n  input (%zu bytes):",
+                     Mismatch.m_pImplementation, static_cast<int>(Mismatch.m_Expected.m_Outcome),
+                     static_cast<long long>(Mismatch.m_Expected.m_Seconds), static_cast<int>(Mismatch.m_Actual.m_Outcome),
+                     static_cast<long long>(Mismatch.m_Actual.m_Seconds), Input.size());
+        for (size_t i = 0; i < Input.size() && i < 256; ++i)
+            std::fprintf(stderr, " %02x", static_cast<unsigned char>(Input[i]));
+        std::fprintf(stderr, "\n");
+        return false;
+    }
+
+    bool CheckFile(const std::filesystem::path &Path, std::array<SLatency, NUM_IMPLEMENTATIONS> &aLatency) {
+        std::ifstream File(Path, std::ios::binary);
+        const std::string Input((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+        if (Check(Input, aLatency))
+            return true;
+        std::fprintf(stderr, "  from %s\n", Path.string().c_str());
+        return false;
+    }
+}
+
+int main(int argc, char **argv) {
+    const SOptions Options = ParseOptions(argc, argv);
+    std::array<SLatency, NUM_IMPLEMENTATIONS> aLatency{};
+    size_t Inputs = 0;
+
+    for (const auto &Entry: Options.m_vCorpus) {
+        const std::filesystem::path Path(Entry);
+        if (std::filesystem::is_directory(Path)) {
+            for (const auto &File: std::filesystem::recursive_directory_iterator(Path)) {
+                if (!File.is_regular_file())
+                    continue;
+                if (!CheckFile(File.path(), aLatency))
+                    return 1;
+                ++Inputs;
+            }
+        } else {
+            if (!CheckFile(Path, aLatency))
+                return 1;
+            ++Inputs;
+        }
+    }
+
+    std::mt19937_64 Rng(Options.m_Seed);
+    for (size_t i = 0; i < Options.m_Runs; ++i, ++Inputs) {
+        if (!Check(RandomInput(Rng, Options.m_MaxLength), aLatency))
+            return 1;
+    }
+
+    if (Options.m_PathologicalSize > 0) {
+        for (const auto &[Name, Input]: PathologicalInputs(Options.m_PathologicalSize)) {
+            std::array<SLatency, NUM_IMPLEMENTATIONS> aCase{};
+            if (!Check(Input, aCase))
+                return 1;
+            ++Inputs;
+            std::printf("%-20s", Name.c_str());
+            for (size_t i = 0; i < NUM_IMPLEMENTATIONS; ++i)
+                std::printf(" %8.2f", aCase[i].m_WorstNanosecondsPerByte);
+            std::printf("  ns/byte\n");
+            for (size_t i = 0; i < NUM_IMPLEMENTATIONS; ++i) {
+                if (aCase[i].m_WorstNanosecondsPerByte > aLatency[i].m_WorstNanosecondsPerByte) {
+                    aLatency[i].m_WorstNanosecondsPerByte = aCase[i].m_WorstNanosecondsPerByte;
+                    aLatency[i].m_WorstPerByteLength = aCase[i].m_WorstPerByteLength;
+                }
+                if (aCase[i].m_WorstNanoseconds > aLatency[i].m_WorstNanoseconds) {
+                    aLatency[i].m_WorstNanoseconds = aCase[i].m_WorstNanoseconds;
+                    aLatency[i].m_WorstLength = aCase[i].m_WorstLength;
+                }
+            }
+        }
+    }
+
+    std::printf("\n%zu inputs, all implementations agree with the reference scanner\n\n", Inputs);
+    std::printf("%-34s %14s %10s %12s %10s\n", "implementation", "worst ns", "bytes", "worst ns/B", "bytes");
+    bool WithinBudget = true;
+    for (size_t i = 0; i < NUM_IMPLEMENTATIONS; ++i) {
+        const auto &Latency = aLatency[i];
+        std::printf("%-34s %14llu %10zu %12.2f %10zu\n", IMPLEMENTATIONS[i].m_pName,
+                    static_cast<unsigned long long>(Latency.m_WorstNanoseconds), Latency.m_WorstLength,
+                    Latency.m_WorstNanosecondsPerByte, Latency.m_WorstPerByteLength);
+        if (Options.m_MaxNanosecondsPerByte > 0 && Latency.m_WorstNanosecondsPerByte > Options.m_MaxNanosecondsPerByte) {
+            std::fprintf(stderr, "%s exceeds the budget of %.2f ns/byte\n", IMPLEMENTATIONS[i].m_pName,
+                         Options.m_MaxNanosecondsPerByte);
+            WithinBudget = false;
+        }
+    }
+    return WithinBudget ? 0 : 1;
+}
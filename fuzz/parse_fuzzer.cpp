@@ -0,0 +1,21 @@
+// libFuzzer entry point: clang++ -fsanitize=fuzzer,address,undefined
+// Slow inputs are reported by libFuzzer itself (-report_slow_units, -timeout).
+#include "differential.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *pData, const size_t Size) {
+    static std::array<timeduration::fuzz::SLatency, timeduration::fuzz::NUM_IMPLEMENTATIONS> s_aLatency;
+
+    const std::string_view Input(reinterpret_cast<const char *>(pData), Size);
+    const auto Mismatch = timeduration::fuzz::CheckInput(Input, s_aLatency);
+    if (Mismatch.m_pImplementation) {
+        std::fprintf(stderr, "%s: expected outcome %d (%lld s), got outcome %d (%lld s)\n",
+                     Mismatch.m_pImplementation, static_cast<int>(Mismatch.m_Expected.m_Outcome),
+                     static_cast<long long>(Mismatch.m_Expected.m_Seconds), static_cast<int>(Mismatch.m_Actual.m_Outcome),
+                     static_cast<long long>(Mismatch.m_Actual.m_Seconds));
+        std::abort();
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+#ifndef TIMEDURATION_FUZZ_REFERENCE_SCANNER_HPP
+#define TIMEDURATION_FUZZ_REFERENCE_SCANNER_HPP
+
+#include <cctype>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * Frozen copy of CTimePeriod::CScanner and Parse() as of 0.1.2, the semantics every
+ * parse implementation must reproduce:
+ *  - a number without unit counts as minutes (AddValue(60, ...))
+ *  - unknown units are ignored, the number before them is dropped
+ *  - repeated units are summed
+ *  - anything that is not a digit run starting a token is skipped
+ *
+ * Do not optimize this file. The only changes against the original are that
+ * isdigit/isalpha take unsigned char (same result in the "C" locale, no UB for bytes
+ * above 0x7F), that bytes above 0x7F belong to unit names so "5\xC2\xB5s" is an
+ * unknown unit rather than five minutes, and that sums which overflowed int64_t
+ * (undefined behaviour in the original) are reported instead.
+ */
+namespace timeduration::reference {
+
+enum class EOutcome {
+    OK,
+    NUMBER_OVERFLOW, // a digit run exceeds int64_t, Parse() throws std::out_of_range
+    TOTAL_OVERFLOW,  // the total exceeds int64_t seconds, undefined in the original Parse(), now std::out_of_range
+};
+
+struct SResult {
+    EOutcome m_Outcome = EOutcome::OK;
+    int64_t m_Seconds = 0;
+};
+
+class CScanner final {
+public:
+    using TokenHolder = std::map<std::string, int64_t>;
+    using ResultHolder = std::map<int64_t, int64_t>;
+
+private:
+    const std::string m_Source;
+    TokenHolder m_Tokens;
+    ResultHolder m_Result;
+    bool m_Overflow = false;
+
+    size_t m_Start = 0;
+    size_t m_Current = 0;
+
+    [[nodiscard]] bool AtEnd() const {
+        return m_Current >= m_Source.length();
+    }
+
+    char Advance() {
+        return m_Source[m_Current++];
+    }
+
+    [[nodiscard]] char Peek() const {
+        if (AtEnd()) return '\0';
+        return m_Source[m_Current];
+    }
+
+    static bool IsDigit(const char c) {
+        return isdigit(static_cast<unsigned char>(c));
+    }
+
+    static bool IsAlpha(const char c) {
+        return isalpha(static_cast<unsigned char>(c)) || static_cast<unsigned char>(c) > 0x7F;
+    }
+
+    void ScanToken() {
+        if (const char c = Advance(); IsDigit(c)) {
+            while (IsDigit(Peek())) Advance();
+            const std::string Value = m_Source.substr(m_Start, m_Current - m_Start);
+            const size_t Offset = m_Current;
+
+            while (IsAlpha(Peek())) Advance();
+            const std::string Literal = m_Source.substr(Offset, m_Current - Offset);
+
+            if (Literal.empty())
+                AddValue(60, std::stoll(Value));
+            else
+                AddValue(Literal, std::stoll(Value));
+        }
+    }
+
+    void AddValue(const std::string_view Literal, const int64_t Value) {
+        if (const auto TokIt = m_Tokens.find(Literal.data()); TokIt != m_Tokens.end())
+            AddValue(TokIt->second, Value);
+    }
+
+    void AddValue(int64_t Multiplier, int64_t Value) {
+        if (const auto ResIt = m_Result.find(Multiplier); ResIt != m_Result.end())
+            m_Overflow |= __builtin_add_overflow(ResIt->second, Value, &ResIt->second);
+        else
+            m_Result.emplace(Multiplier, Value);
+    }
+
+public:
+    explicit CScanner(const std::string_view Source, TokenHolder Multipliers) : m_Source(Source),
+        m_Tokens(std::move(Multipliers)) {
+    }
+
+    [[nodiscard]] ResultHolder ScanTokens() {
+        while (!AtEnd()) {
+            m_Start = m_Current;
+            ScanToken();
+        }
+        return m_Result;
+    }
+
+    [[nodiscard]] bool Overflowed() const {
+        return m_Overflow;
+    }
+};
+
+[[nodiscard]] inline SResult Parse(const std::string_view from) {
+    CScanner Scanner(from, {
+        {"s", 1L}, {"seconds", 1L},
+        {"m", 60L}, {"minutes", 60L},
+        {"h", 3600L}, {"hours", 3600L},
+        {"d", 86400L}, {"days", 86400L},
+        {"mo", 2419200L}, {"months", 2419200L},
+        {"y", 31536000L}, {"years", 31536000L},
+    });
+
+    CScanner::ResultHolder Result;
+    try {
+        Result = Scanner.ScanTokens();
+    } catch (const std::out_of_range &) {
+        return {EOutcome::NUMBER_OVERFLOW, 0};
+    }
+
+    int64_t Total = 0;
+    bool Overflow = Scanner.Overflowed();
+    for (auto [Multiplier, Value]: Result) {
+        int64_t Product = 0;
+        Overflow |= __builtin_mul_overflow(Multiplier, Value, &Product);
+        Overflow |= __builtin_add_overflow(Total, Product, &Total);
+    }
+    if (Overflow)
+        return {EOutcome::TOTAL_OVERFLOW, 0};
+    return {EOutcome::OK, Total};
+}
+
+} // namespace timeduration::reference
+
+#endif // TIMEDURATION_FUZZ_REFERENCE_SCANNER_HPP
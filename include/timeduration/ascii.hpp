@@ -0,0 +1,64 @@
+#ifndef TIMEDURATION_ASCII_HPP
+#define TIMEDURATION_ASCII_HPP
+
+#include <array>
+#include <cstdint>
+
+/**
+ * Character classification for every parser in the library. Unlike <cctype> it ignores
+ * the global locale, is constexpr, and is defined for every char value including the
+ * negative ones that UTF-8 bytes become on signed-char platforms.
+ */
+namespace timeduration {
+
+namespace detail {
+    enum ECharClass : uint8_t {
+        CHAR_DIGIT = 1 << 0, // 0-9
+        CHAR_ALPHA = 1 << 1, // A-Z, a-z
+        CHAR_SPACE = 1 << 2, // space and tab, the separators the grammars allow
+        CHAR_UNIT = 1 << 3,  // letters and every byte above 0x7F, so "µs" is one unit name
+    };
+
+    inline constexpr std::array<uint8_t, 256> CHAR_CLASSES = [] {
+        std::array<uint8_t, 256> aClasses{};
+        for (int c = '0'; c <= '9'; ++c)
+            aClasses[c] = CHAR_DIGIT;
+        for (int c = 'A'; c <= 'Z'; ++c) {
+            aClasses[c] = CHAR_ALPHA | CHAR_UNIT;
+            aClasses[c - 'A' + 'a'] = CHAR_ALPHA | CHAR_UNIT;
+        }
+        aClasses[' '] = CHAR_SPACE;
+        aClasses['\t'] = CHAR_SPACE;
+        for (int c = 0x80; c <= 0xFF; ++c)
+            aClasses[c] = CHAR_UNIT;
+        return aClasses;
+    }();
+
+    [[nodiscard]] constexpr bool HasCharClass(const char c, const uint8_t Classes) noexcept {
+        return (CHAR_CLASSES[static_cast<unsigned char>(c)] & Classes) != 0;
+    }
+
+    [[nodiscard]] constexpr bool IsDigitAscii(const char c) noexcept {
+        return HasCharClass(c, CHAR_DIGIT);
+    }
+
+    [[nodiscard]] constexpr bool IsAlphaAscii(const char c) noexcept {
+        return HasCharClass(c, CHAR_ALPHA);
+    }
+
+    [[nodiscard]] constexpr bool IsSpaceAscii(const char c) noexcept {
+        return HasCharClass(c, CHAR_SPACE);
+    }
+
+    [[nodiscard]] constexpr bool IsUnitChar(const char c) noexcept {
+        return HasCharClass(c, CHAR_UNIT);
+    }
+
+    [[nodiscard]] constexpr char ToUpperAscii(const char c) noexcept {
+        return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+    }
+} // namespace detail
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_ASCII_HPP
@@ -0,0 +1,160 @@
+#ifndef TIMEDURATION_ATOMIC_HPP
+#define TIMEDURATION_ATOMIC_HPP
+
+#include <timeduration/core.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace timeduration {
+
+/**
+ * @brief A duration that many threads can add to without a lock
+ *
+ * One relaxed fetch_add per Add. Fine for a handful of writers; under heavy contention all
+ * of them fight over one cache line, use CDurationAccumulator then. Sums wrap on int64_t
+ * overflow instead of being undefined.
+ */
+class CAtomicDuration final {
+    std::atomic<int64_t> m_Seconds{0};
+
+public:
+    CAtomicDuration() noexcept = default;
+
+    explicit CAtomicDuration(const std::chrono::seconds Initial) noexcept : m_Seconds(Initial.count()) {}
+
+    CAtomicDuration(const CAtomicDuration &) = delete;
+    CAtomicDuration &operator=(const CAtomicDuration &) = delete;
+
+    void Add(const std::chrono::seconds Duration) noexcept {
+        m_Seconds.fetch_add(Duration.count(), std::memory_order_relaxed);
+    }
+
+    void Add(const CTimePeriod &Period) noexcept {
+        Add(Period.duration());
+    }
+
+    void Store(const std::chrono::seconds Duration) noexcept {
+        m_Seconds.store(Duration.count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Replace the value, e.g. with zero at the end of a reporting interval
+     *
+     * @return std::chrono::seconds The value before the exchange
+     */
+    std::chrono::seconds Exchange(const std::chrono::seconds Duration) noexcept {
+        return std::chrono::seconds(m_Seconds.exchange(Duration.count(), std::memory_order_relaxed));
+    }
+
+    [[nodiscard]] std::chrono::seconds Load() const noexcept {
+        return std::chrono::seconds(m_Seconds.load(std::memory_order_relaxed));
+    }
+
+    [[nodiscard]] CTimePeriod Period() const noexcept {
+        return CTimePeriod(Load());
+    }
+};
+
+namespace detail {
+    // Same cache line size the instrumentation counters assume
+    inline constexpr size_t ACCUMULATOR_SHARD_ALIGNMENT = 64;
+
+    struct alignas(ACCUMULATOR_SHARD_ALIGNMENT) SAccumulatorShard {
+        std::atomic<int64_t> m_Seconds{0};
+    };
+
+    // Threads are numbered once, in the order they first touch any accumulator
+    inline size_t AccumulatorThreadIndex() noexcept {
+        static std::atomic<size_t> s_NextIndex{0};
+        thread_local const size_t s_Index = s_NextIndex.fetch_add(1, std::memory_order_relaxed);
+        return s_Index;
+    }
+
+    [[nodiscard]] inline size_t DefaultShardCount() noexcept {
+        size_t Count = 1;
+        while (Count < std::thread::hardware_concurrency() && Count < 256)
+            Count <<= 1;
+        return Count;
+    }
+} // namespace detail
+
+/**
+ * @brief A duration sum sharded over cache-line padded counters
+ *
+ * Each thread adds to its own shard (threads are spread round-robin over the shards) with a
+ * relaxed fetch_add, so writers on different shards never share a cache line. Reads sum all
+ * shards; they see every Add that happened before them, but a read racing with writers is
+ * not a snapshot of a single instant. Sums wrap on int64_t overflow instead of being undefined.
+ */
+class CDurationAccumulator final {
+    size_t m_Mask;
+    std::unique_ptr<detail::SAccumulatorShard[]> m_aShards;
+
+public:
+    /**
+     * @param Shards Number of shards, rounded up to a power of two; 0 picks one per hardware thread
+     */
+    explicit CDurationAccumulator(size_t Shards = 0) {
+        if (Shards == 0)
+            Shards = detail::DefaultShardCount();
+        size_t Count = 1;
+        while (Count < Shards)
+            Count <<= 1;
+        m_Mask = Count - 1;
+        m_aShards = std::make_unique<detail::SAccumulatorShard[]>(Count);
+    }
+
+    CDurationAccumulator(const CDurationAccumulator &) = delete;
+    CDurationAccumulator &operator=(const CDurationAccumulator &) = delete;
+
+    [[nodiscard]] size_t ShardCount() const noexcept {
+        return m_Mask + 1;
+    }
+
+    void Add(const std::chrono::seconds Duration) noexcept {
+        m_aShards[detail::AccumulatorThreadIndex() & m_Mask].m_Seconds.fetch_add(Duration.count(),
+                                                                               std::memory_order_relaxed);
+    }
+
+    void Add(const CTimePeriod &Period) noexcept {
+        Add(Period.duration());
+    }
+
+    /**
+     * @brief Sum of all shards
+     */
+    [[nodiscard]] std::chrono::seconds Load() const noexcept {
+        // Unsigned so that a wrapped sum stays well-defined, like the shards themselves
+        uint64_t Total = 0;
+        for (size_t i = 0; i <= m_Mask; ++i)
+            Total += static_cast<uint64_t>(m_aShards[i].m_Seconds.load(std::memory_order_relaxed));
+        return std::chrono::seconds(static_cast<int64_t>(Total));
+    }
+
+    [[nodiscard]] CTimePeriod Period() const noexcept {
+        return CTimePeriod(Load());
+    }
+
+    /**
+     * @brief Take the sum and reset every shard to zero, e.g. at the end of a reporting interval
+     *
+     * An Add racing with the reset lands either in this sum or in the next one, never in neither.
+     *
+     * @return std::chrono::seconds Sum of all shards before the reset
+     */
+    std::chrono::seconds TakeAndReset() noexcept {
+        uint64_t Total = 0;
+        for (size_t i = 0; i <= m_Mask; ++i)
+            Total += static_cast<uint64_t>(m_aShards[i].m_Seconds.exchange(0, std::memory_order_relaxed));
+        return std::chrono::seconds(static_cast<int64_t>(Total));
+    }
+};
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_ATOMIC_HPP
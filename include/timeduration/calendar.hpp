@@ -0,0 +1,277 @@
+#ifndef TIMEDURATION_CALENDAR_HPP
+#define TIMEDURATION_CALENDAR_HPP
+
+#include <timeduration/parse.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace timeduration {
+
+/**
+ * @brief A duration whose months and years stay symbolic until it is applied to a date
+ *
+ * Parse flattens "1mo" to 28 days and "1y" to 365 days; this keeps them as calendar months
+ * so that adding it to a timestamp lands on the same day of a later month.
+ */
+struct SCalendarPeriod {
+    int64_t m_Months = 0;            // months plus 12 per year, applied on the civil calendar
+    std::chrono::seconds m_Exact{0}; // seconds, minutes, hours and days, applied afterwards
+};
+
+namespace detail {
+    inline constexpr int64_t SECONDS_PER_DAY = 86400;
+
+    // Floor division, the truncating operator would round dates before the epoch towards it
+    [[nodiscard]] constexpr int64_t FloorDiv(const int64_t Value, const int64_t Divisor) noexcept {
+        return Value / Divisor - (Value % Divisor < 0);
+    }
+
+    struct SCivilDate {
+        int64_t m_Year;
+        int64_t m_Month; // 1..12
+        int64_t m_Day;   // 1..31
+    };
+
+    // Days in each month of a non-leap year, February is corrected by IsLeap
+    inline constexpr std::array<int64_t, 12> MONTH_DAYS{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    // A multiple of 100 is a multiple of 400 exactly when it is a multiple of 16
+    [[nodiscard]] constexpr bool IsLeap(const int64_t Year) noexcept {
+        return (Year % 100 != 0 ? Year % 4 : Year % 16) == 0;
+    }
+
+    [[nodiscard]] constexpr int64_t LastDayOfMonth(const int64_t Year, const int64_t Month) noexcept {
+        return MONTH_DAYS[Month - 1] + (Month == 2 && IsLeap(Year));
+    }
+
+    /**
+     * Days since 1970-01-01 of a proleptic Gregorian date, after H. Hinnant's days_from_civil:
+     * years are counted from March so the leap day is last, and whole 400-year eras are split
+     * off first. Covers every date whose day number fits int64_t, see FastDaysFromCivil for
+     * the common range.
+     */
+    [[nodiscard]] constexpr int64_t DaysFromCivil(const SCivilDate &Date) noexcept {
+        const int64_t Year = Date.m_Year - (Date.m_Month <= 2);
+        const int64_t Era = FloorDiv(Year, 400);
+        const int64_t YearOfEra = Year - Era * 400;
+        const int64_t MonthFromMarch = Date.m_Month + (Date.m_Month > 2 ? -3 : 9);
+        const int64_t DayOfYear = (153 * MonthFromMarch + 2) / 5 + Date.m_Day - 1;
+        const int64_t DayOfEra = YearOfEra * 365 + YearOfEra / 4 - YearOfEra / 100 + DayOfYear;
+        return Era * 146097 + DayOfEra - 719468;
+    }
+
+    // Inverse of DaysFromCivil
+    [[nodiscard]] constexpr SCivilDate CivilFromDays(const int64_t Days) noexcept {
+        const int64_t Shifted = Days + 719468;
+        const int64_t Era = FloorDiv(Shifted, 146097);
+        const int64_t DayOfEra = Shifted - Era * 146097;
+        const int64_t YearOfEra = (DayOfEra - DayOfEra / 1460 + DayOfEra / 36524 - DayOfEra / 146096) / 365;
+        const int64_t DayOfYear = DayOfEra - (365 * YearOfEra + YearOfEra / 4 - YearOfEra / 100);
+        const int64_t MonthFromMarch = (5 * DayOfYear + 2) / 153;
+        const int64_t Month = MonthFromMarch + (MonthFromMarch < 10 ? 3 : -9);
+        return {YearOfEra + Era * 400 + (Month <= 2), Month, DayOfYear - (153 * MonthFromMarch + 2) / 5 + 1};
+    }
+
+    /**
+     * 32-bit variants after Neri and Schneider, "Euclidean Affine Functions and Applications to
+     * Calendar Algorithms" (propositions 6.2 and 6.3): every division is by a constant and becomes
+     * a multiply-shift, and there are no eras to split off. Years are offset by FAST_YEAR_SHIFT
+     * (a multiple of 400, so leap years stay leap years) to keep the arithmetic unsigned.
+     * Valid for the std::chrono::year range, -32767-01-01 to 32767-12-31.
+     */
+    inline constexpr uint32_t FAST_YEAR_SHIFT = 1468000;
+    inline constexpr uint32_t FAST_DAY_SHIFT = 536895458;
+    inline constexpr int64_t FAST_MIN_DAYS = -12687428;
+    inline constexpr int64_t FAST_MAX_DAYS = 11248737;
+    // Moving a date of the range by at most this many months stays within 32-bit arithmetic
+    inline constexpr int64_t FAST_MAX_MONTHS = 12 * 65535;
+    static_assert(FAST_YEAR_SHIFT % 400 == 0);
+
+    [[nodiscard]] constexpr SCivilDate FastCivilFromDays(const int64_t Days) noexcept {
+        const uint32_t Shifted = static_cast<uint32_t>(Days) + FAST_DAY_SHIFT;
+
+        const uint32_t N1 = 4 * Shifted + 3;
+        const uint32_t Century = N1 / 146097;
+        const uint32_t DayOfCentury = N1 % 146097 / 4;
+
+        const uint32_t N2 = 4 * DayOfCentury + 3;
+        const uint64_t P2 = uint64_t{2939745} * N2;
+        const uint32_t YearOfCentury = static_cast<uint32_t>(P2 >> 32);
+        const uint32_t DayOfYear = static_cast<uint32_t>(P2) / 2939745 / 4; // from March 1st
+
+        const uint32_t N3 = 2141 * DayOfYear + 197913;
+        const uint32_t January = DayOfYear >= 306;
+        const uint32_t Month = (N3 >> 16) - (January ? 12 : 0);
+        return {100 * Century + YearOfCentury + January, Month, (N3 & 0xFFFF) / 2141 + 1};
+    }
+
+    // Date.m_Year is shifted by FAST_YEAR_SHIFT
+    [[nodiscard]] constexpr int64_t FastDaysFromCivil(const SCivilDate &Date) noexcept {
+        const uint32_t January = Date.m_Month < 3;
+        const uint32_t Year = static_cast<uint32_t>(Date.m_Year) - January;
+        const uint32_t Month = static_cast<uint32_t>(Date.m_Month) + (January ? 12 : 0);
+
+        const uint32_t Century = Year / 100;
+        const uint32_t YearDays = 1461 * Year / 4 - Century + Century / 4;
+        const uint32_t MonthDays = (979 * Month - 2919) / 32;
+        return static_cast<int32_t>(YearDays + MonthDays + static_cast<uint32_t>(Date.m_Day) - 1 - FAST_DAY_SHIFT);
+    }
+
+    // Moves a day number by Months calendar months, clamping to the end of a shorter month
+    [[nodiscard]] constexpr int64_t AddMonthsToDays(const int64_t Days, const int64_t Months) noexcept {
+        if (Days >= FAST_MIN_DAYS && Days <= FAST_MAX_DAYS && Months >= -FAST_MAX_MONTHS && Months <= FAST_MAX_MONTHS) {
+            const SCivilDate Date = FastCivilFromDays(Days);
+            const auto Index = static_cast<uint32_t>(Date.m_Year * 12 + Date.m_Month - 1 + Months);
+            const uint32_t Year = Index / 12;
+            const uint32_t Month = Index % 12 + 1;
+            return FastDaysFromCivil({Year, Month, std::min(Date.m_Day, LastDayOfMonth(Year, Month))});
+        }
+
+        const SCivilDate Date = CivilFromDays(Days);
+        const int64_t Index = Date.m_Year * 12 + Date.m_Month - 1 + Months;
+        const int64_t Year = FloorDiv(Index, 12);
+        const int64_t Month = Index - Year * 12 + 1;
+        return DaysFromCivil({Year, Month, std::min(Date.m_Day, LastDayOfMonth(Year, Month))});
+    }
+} // namespace detail
+
+/**
+ * @brief Parse the native grammar keeping months and years symbolic, without allocating or throwing
+ *
+ * Same grammar as CTimePeriod::TryParse; "mo"/"months" add one calendar month each and
+ * "y"/"years" twelve, every other unit goes to m_Exact.
+ *
+ * @param from String representation of time duration (e.g. "1mo 2d")
+ * @param Out Receives the period on success
+ * @param Limits Maximum input length and number count
+ * @return false if a limit is exceeded or a value or a total overflows int64_t
+ */
+[[nodiscard]] inline bool TryParseCalendar(const std::string_view from, SCalendarPeriod &Out,
+                                           const SParseLimits &Limits = SParseLimits()) noexcept {
+    constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+
+    if (from.size() > Limits.m_MaxLength)
+        return false;
+
+    const instrumentation::CParseScope Scope(from.size());
+    int64_t Months = 0;
+    int64_t Exact = 0;
+    const bool Success = detail::ScanNative(from, Limits, [&Months, &Exact](const ENativeUnit Unit, const int64_t Value) {
+        const bool Calendar = Unit == UNIT_MONTHS || Unit == UNIT_YEARS;
+        const int64_t Multiplier = Unit == UNIT_YEARS ? 12 : Calendar ? 1 : NATIVE_UNIT_SECONDS[Unit];
+        int64_t &Total = Calendar ? Months : Exact;
+        if (Value > Max / Multiplier || Total > Max - Value * Multiplier) {
+            instrumentation::CountOverflow();
+            return false;
+        }
+        Total += Value * Multiplier;
+        return true;
+    });
+    if (!Success)
+        return false;
+
+    Out = SCalendarPeriod{Months, std::chrono::seconds(Exact)};
+    return true;
+}
+
+/**
+ * @brief Apply a calendar period to a timestamp
+ *
+ * Months are added first on the proleptic Gregorian calendar, keeping the time of day and
+ * clamping the day to the end of a shorter month (Jan 31 + 1mo is Feb 28 or 29); m_Exact is
+ * added afterwards. Negative fields subtract. The result must be representable in sys_seconds.
+ *
+ * @param Time Timestamp (UTC)
+ * @param Period Period to add
+ * @return std::chrono::sys_seconds Shifted timestamp
+ */
+[[nodiscard]] constexpr std::chrono::sys_seconds AddCalendar(const std::chrono::sys_seconds Time,
+                                                             const SCalendarPeriod &Period) noexcept {
+    const int64_t Seconds = Time.time_since_epoch().count();
+    const int64_t Days = detail::FloorDiv(Seconds, detail::SECONDS_PER_DAY);
+    const int64_t TimeOfDay = Seconds - Days * detail::SECONDS_PER_DAY;
+    const int64_t Shifted = Period.m_Months == 0 ? Days : detail::AddMonthsToDays(Days, Period.m_Months);
+    return std::chrono::sys_seconds(std::chrono::seconds(Shifted * detail::SECONDS_PER_DAY + TimeOfDay) + Period.m_Exact);
+}
+
+namespace detail {
+    // A per-day table pays for itself once each day is hit this many times on average
+    inline constexpr size_t CALENDAR_TABLE_MIN_HITS = 8;
+} // namespace detail
+
+/**
+ * @brief Apply one calendar period to every timestamp of a batch
+ *
+ * When the batch is dense in days (millions of renewals over a few decades), the shift of
+ * every day between the earliest and latest timestamp is computed once into a table and each
+ * timestamp costs one lookup and one add, in any order. Otherwise timestamps on the same day
+ * as their predecessor reuse its shift, so sorted or clustered input still mostly skips the
+ * civil-date conversion. In and Out may be the same span.
+ *
+ * @param In Timestamps (UTC)
+ * @param Period Period to add
+ * @param Out Receives In.size() shifted timestamps, must be at least as large as In
+ * @throws std::invalid_argument if Out is smaller than In
+ * @throws std::bad_alloc if the day table cannot be allocated
+ */
+inline void AddCalendar(const std::span<const std::chrono::sys_seconds> In, const SCalendarPeriod &Period,
+                        const std::span<std::chrono::sys_seconds> Out) {
+    if (Out.size() < In.size())
+        throw std::invalid_argument("output span must be at least as large as the input");
+    const size_t Size = In.size();
+    const int64_t Exact = Period.m_Exact.count();
+
+    if (Period.m_Months == 0) {
+        for (size_t i = 0; i < Size; ++i)
+            Out[i] = std::chrono::sys_seconds(std::chrono::seconds(In[i].time_since_epoch().count() + Exact));
+        return;
+    }
+    if (Size == 0)
+        return;
+
+    const auto [MinIt, MaxIt] = std::minmax_element(In.begin(), In.begin() + static_cast<std::ptrdiff_t>(Size));
+    const int64_t MinDay = detail::FloorDiv(MinIt->time_since_epoch().count(), detail::SECONDS_PER_DAY);
+    const int64_t MaxDay = detail::FloorDiv(MaxIt->time_since_epoch().count(), detail::SECONDS_PER_DAY);
+    // Unsigned, a span across most of the int64_t range wraps instead of overflowing
+    const uint64_t DayRange = static_cast<uint64_t>(MaxDay) - static_cast<uint64_t>(MinDay) + 1;
+
+    if (DayRange <= Size / detail::CALENDAR_TABLE_MIN_HITS) {
+        // Seconds to add to a timestamp on day MinDay + i, Exact included
+        std::vector<int64_t> Shifts(DayRange);
+        for (size_t i = 0; i < Shifts.size(); ++i) {
+            const int64_t Days = MinDay + static_cast<int64_t>(i);
+            Shifts[i] = (detail::AddMonthsToDays(Days, Period.m_Months) - Days) * detail::SECONDS_PER_DAY + Exact;
+        }
+        for (size_t i = 0; i < Size; ++i) {
+            const int64_t Seconds = In[i].time_since_epoch().count();
+            const int64_t Days = detail::FloorDiv(Seconds, detail::SECONDS_PER_DAY);
+            Out[i] = std::chrono::sys_seconds(std::chrono::seconds(Seconds + Shifts[static_cast<size_t>(Days - MinDay)]));
+        }
+        return;
+    }
+
+    int64_t CachedDay = std::numeric_limits<int64_t>::min();
+    int64_t CachedShift = 0; // seconds to add to a timestamp on CachedDay, Exact included
+    for (size_t i = 0; i < Size; ++i) {
+        const int64_t Seconds = In[i].time_since_epoch().count();
+        const int64_t Days = detail::FloorDiv(Seconds, detail::SECONDS_PER_DAY);
+        if (Days != CachedDay) {
+            CachedDay = Days;
+            CachedShift = (detail::AddMonthsToDays(Days, Period.m_Months) - Days) * detail::SECONDS_PER_DAY + Exact;
+        }
+        Out[i] = std::chrono::sys_seconds(std::chrono::seconds(Seconds + CachedShift));
+    }
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_CALENDAR_HPP
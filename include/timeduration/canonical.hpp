@@ -0,0 +1,238 @@
+#ifndef TIMEDURATION_CANONICAL_HPP
+#define TIMEDURATION_CANONICAL_HPP
+
+#include <timeduration/display.hpp>
+#include <timeduration/parse.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace timeduration {
+
+namespace detail {
+    // "<value><unit> " for one component below a day, e.g. "5h " or "59m ", copied as one 4-byte block
+    struct SCanonicalSegment {
+        std::array<char, 4> m_aText{};
+        uint8_t m_Length = 0;
+    };
+
+    // One table per unit (hours, minutes, seconds); zero has length 0 so it is skipped without a branch
+    inline constexpr std::array<std::array<SCanonicalSegment, 60>, 3> CANONICAL_SEGMENTS = [] {
+        constexpr std::array<char, 3> aUnits{'h', 'm', 's'};
+        std::array<std::array<SCanonicalSegment, 60>, 3> aSegments{};
+        for (size_t Unit = 0; Unit < aUnits.size(); ++Unit) {
+            for (uint8_t Value = 1; Value < 60; ++Value) {
+                auto &Segment = aSegments[Unit][Value];
+                if (Value >= 10)
+                    Segment.m_aText[Segment.m_Length++] = static_cast<char>('0' + Value / 10);
+                Segment.m_aText[Segment.m_Length++] = static_cast<char>('0' + Value % 10);
+                Segment.m_aText[Segment.m_Length++] = aUnits[Unit];
+                Segment.m_aText[Segment.m_Length++] = ' ';
+            }
+        }
+        return aSegments;
+    }();
+
+    // Inputs of at most this many bytes are looked up; the length goes into the key's top byte
+    inline constexpr size_t COMMON_KEY_MAX_LENGTH = 7;
+    inline constexpr size_t COMMON_TABLE_SLOTS = 512;
+
+    [[nodiscard]] constexpr uint64_t CommonKey(const std::string_view Text) noexcept {
+        uint64_t Key = static_cast<uint64_t>(Text.size()) << 56;
+        for (size_t i = 0; i < Text.size(); ++i)
+            Key |= static_cast<uint64_t>(static_cast<unsigned char>(Text[i])) << (8 * i);
+        return Key;
+    }
+
+    [[nodiscard]] constexpr size_t CommonSlot(const uint64_t Key) noexcept {
+        // Fold the length and high bytes onto the low ones, then Fibonacci hashing (top 9 bits)
+        return static_cast<size_t>(((Key ^ (Key >> 32)) * 0x9E3779B97F4A7C15u) >> 55);
+    }
+
+    /**
+     * Exact-match table for the duration strings seen most in practice: every canonical
+     * single-unit value below a day plus up to 31 days, hours with 15/30/45 minutes, minutes
+     * with 30 seconds, and a few popular non-canonical spellings ("90s", "24h"). Open
+     * addressing with linear probing; the key holds the length and the bytes, so a probe is a
+     * single 64-bit compare.
+     */
+    struct SCommonTable {
+        std::array<uint64_t, COMMON_TABLE_SLOTS> m_aKeys{};   // 0 marks an empty slot
+        std::array<int32_t, COMMON_TABLE_SLOTS> m_aSeconds{};
+        size_t m_Entries = 0;
+        size_t m_MaxProbes = 0;
+
+        constexpr void Insert(const std::string_view Text, const int32_t Seconds) {
+            const uint64_t Key = CommonKey(Text);
+            size_t Probes = 1;
+            size_t Slot = CommonSlot(Key);
+            for (; m_aKeys[Slot] != 0; Slot = (Slot + 1) % COMMON_TABLE_SLOTS, ++Probes) {
+                if (m_aKeys[Slot] == Key)
+                    return;
+            }
+            m_aKeys[Slot] = Key;
+            m_aSeconds[Slot] = Seconds;
+            ++m_Entries;
+            m_MaxProbes = std::max(m_MaxProbes, Probes);
+        }
+
+        // Text is "<A><UnitA>" or "<A><UnitA> <B><UnitB>", built without std::string to stay constexpr
+        constexpr void Insert(const int A, const char UnitA, const int32_t SecondsA, const int B = 0,
+                              const char UnitB = 0, const int32_t SecondsB = 0) {
+            std::array<char, 16> aText{};
+            size_t Length = 0;
+            const auto Append = [&](const int Value, const char Unit) {
+                if (Value >= 1000)
+                    aText[Length++] = static_cast<char>('0' + Value / 1000);
+                if (Value >= 100)
+                    aText[Length++] = static_cast<char>('0' + Value / 100 % 10);
+                if (Value >= 10)
+                    aText[Length++] = static_cast<char>('0' + Value / 10 % 10);
+                aText[Length++] = static_cast<char>('0' + Value % 10);
+                aText[Length++] = Unit;
+            };
+            Append(A, UnitA);
+            if (UnitB != 0) {
+                aText[Length++] = ' ';
+                Append(B, UnitB);
+            }
+            Insert(std::string_view(aText.data(), Length), A * SecondsA + B * SecondsB);
+        }
+    };
+
+    inline constexpr SCommonTable COMMON_TABLE = [] {
+        SCommonTable Table;
+        for (int Value = 0; Value < 60; ++Value)
+            Table.Insert(Value, 's', 1);
+        for (int Value = 1; Value < 60; ++Value) {
+            Table.Insert(Value, 'm', 60);
+            Table.Insert(Value, 'm', 60, 30, 's', 1);
+        }
+        for (int Value = 1; Value < 24; ++Value) {
+            Table.Insert(Value, 'h', 3600);
+            for (const int Minutes: {15, 30, 45})
+                Table.Insert(Value, 'h', 3600, Minutes, 'm', 60);
+        }
+        for (int Value = 1; Value <= 31; ++Value)
+            Table.Insert(Value, 'd', 86400);
+        for (const int Value: {60, 90, 120, 180, 300, 600, 900, 1800, 3600})
+            Table.Insert(Value, 's', 1);
+        for (const int Value: {60, 90, 120, 180, 240, 360, 720, 1440})
+            Table.Insert(Value, 'm', 60);
+        for (const int Value: {24, 36, 48, 72, 96, 168})
+            Table.Insert(Value, 'h', 3600);
+        return Table;
+    }();
+    static_assert(COMMON_TABLE.m_MaxProbes <= 8, "common duration table needs a better hash");
+
+    [[nodiscard]] constexpr bool LookupCommon(const std::string_view Source, std::chrono::seconds &Out) noexcept {
+        if (Source.empty() || Source.size() > COMMON_KEY_MAX_LENGTH)
+            return false;
+        const uint64_t Key = CommonKey(Source);
+        size_t Slot = CommonSlot(Key);
+        for (size_t Probe = 0; Probe < COMMON_TABLE.m_MaxProbes; ++Probe, Slot = (Slot + 1) % COMMON_TABLE_SLOTS) {
+            if (COMMON_TABLE.m_aKeys[Slot] == Key) {
+                Out = std::chrono::seconds(COMMON_TABLE.m_aSeconds[Slot]);
+                return true;
+            }
+            if (COMMON_TABLE.m_aKeys[Slot] == 0)
+                return false;
+        }
+        return false;
+    }
+} // namespace detail
+
+/**
+ * @brief Parse with an exact-match table for the most common inputs in front of TryParse
+ *
+ * Short strings such as "30s", "5m", "1h 30m" or "24h" are answered by one hash probe;
+ * everything else goes through CTimePeriod::TryParse with the same result it always had.
+ * Table hits are counted by the instrumentation as parses, but their tokens are not.
+ *
+ * @param Source Duration string in the native grammar
+ * @param Out Receives the parsed duration on success
+ * @param Limits Maximum input length and number count, as for TryParse
+ * @return false if TryParse would return false
+ */
+[[nodiscard]] inline bool TryParseCommon(const std::string_view Source, std::chrono::seconds &Out,
+                                         const SParseLimits &Limits = SParseLimits()) noexcept {
+    // Table entries have at most two numbers
+    if (Limits.m_MaxTokens >= 2 && Source.size() <= Limits.m_MaxLength && detail::LookupCommon(Source, Out)) {
+        const instrumentation::CParseScope Scope(Source.size());
+        return true;
+    }
+    return CTimePeriod::TryParse(Source, Out, Limits);
+}
+
+/**
+ * @brief Write the toString() form of a duration into a caller buffer
+ *
+ * Durations from 0 to 86399 seconds, the bulk of real traffic, are assembled from three
+ * precomputed segments with fixed-size copies; longer ones are written by FormatDisplay in its
+ * compact style, which matches toString(). Negative ones follow toString() as well, which only
+ * prints the seconds remainder: -65s gives "-5s" and -3600s gives "0s".
+ *
+ * @param Duration Duration to format
+ * @param Buffer Destination, DISPLAY_MAX_LENGTH bytes always suffice
+ * @return size_t Number of characters written, 0 if the buffer is too small
+ */
+[[nodiscard]] inline size_t FormatCanonical(const std::chrono::seconds Duration, const std::span<char> Buffer) noexcept {
+    const int64_t Count = Duration.count();
+    if (Count < 0) {
+        // From "-59s" to "0s"
+        char Scratch[4];
+        char *const End = std::to_chars(Scratch, Scratch + sizeof(Scratch), Count % 60).ptr;
+        *End = 's';
+        const auto Length = static_cast<size_t>(End - Scratch) + 1;
+        if (Length > Buffer.size())
+            return 0;
+        std::copy_n(Scratch, Length, Buffer.data());
+        return Length;
+    }
+    if (Count == 0 || Count >= 86400)
+        return FormatDisplay(Duration, Buffer);
+
+    const auto Seconds = static_cast<uint32_t>(Count);
+    const auto &Hours = detail::CANONICAL_SEGMENTS[0][Seconds / 3600];
+    const auto &Minutes = detail::CANONICAL_SEGMENTS[1][Seconds / 60 % 60];
+    const auto &Rest = detail::CANONICAL_SEGMENTS[2][Seconds % 60];
+
+    // Up to 11 characters plus the overhang of the last 4-byte copy; large buffers are written directly
+    char Scratch[16];
+    char *const Begin = Buffer.size() >= sizeof(Scratch) ? Buffer.data() : Scratch;
+    char *Out = Begin;
+    std::copy_n(Hours.m_aText.data(), 4, Out);
+    Out += Hours.m_Length;
+    std::copy_n(Minutes.m_aText.data(), 4, Out);
+    Out += Minutes.m_Length;
+    std::copy_n(Rest.m_aText.data(), 4, Out);
+    Out += Rest.m_Length;
+
+    // Drop the trailing space
+    const auto Length = static_cast<size_t>(Out - Begin) - 1;
+    if (Begin == Scratch) {
+        if (Length > Buffer.size())
+            return 0;
+        std::copy_n(Scratch, Length, Buffer.data());
+    }
+    return Length;
+}
+
+/**
+ * @brief Same text as Period.toString(), through FormatCanonical
+ */
+[[nodiscard]] inline std::string ToCanonicalString(const CTimePeriod &Period) {
+    char Buffer[DISPLAY_MAX_LENGTH];
+    return {Buffer, FormatCanonical(Period.duration(), Buffer)};
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_CANONICAL_HPP
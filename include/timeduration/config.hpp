@@ -0,0 +1,410 @@
+#ifndef TIMEDURATION_CONFIG_HPP
+#define TIMEDURATION_CONFIG_HPP
+
+#include <timeduration/iso8601.hpp>
+
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#define TIMEDURATION_HAS_COROUTINES 1
+#else
+#define TIMEDURATION_HAS_COROUTINES 0
+#endif
+
+#if TIMEDURATION_HAS_COROUTINES
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace timeduration {
+
+/**
+ * @brief Minimal lazy generator for range-for consumption
+ *
+ * Yielded references stay valid until the generator is resumed again.
+ */
+template<typename T>
+class CGenerator final {
+public:
+    struct promise_type {
+        const T *m_pValue = nullptr;
+        std::exception_ptr m_Exception;
+
+        CGenerator get_return_object() noexcept {
+            return CGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        std::suspend_always yield_value(const T &Value) noexcept {
+            m_pValue = std::addressof(Value);
+            return {};
+        }
+
+        void return_void() noexcept {}
+        void unhandled_exception() { m_Exception = std::current_exception(); }
+
+        // Generators only yield
+        template<typename U>
+        std::suspend_never await_transform(U &&) = delete;
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    class CIterator {
+        Handle m_Handle;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+
+        CIterator() = default;
+        explicit CIterator(const Handle Coroutine) : m_Handle(Coroutine) {}
+
+        const T &operator*() const { return *m_Handle.promise().m_pValue; }
+        const T *operator->() const { return m_Handle.promise().m_pValue; }
+
+        CIterator &operator++() {
+            m_Handle.resume();
+            if (m_Handle.done() && m_Handle.promise().m_Exception)
+                std::rethrow_exception(m_Handle.promise().m_Exception);
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const CIterator &It, std::default_sentinel_t) { return !It.m_Handle || It.m_Handle.done(); }
+    };
+
+    explicit CGenerator(const Handle Coroutine) : m_Handle(Coroutine) {}
+    CGenerator(CGenerator &&Other) noexcept : m_Handle(std::exchange(Other.m_Handle, {})) {}
+    CGenerator(const CGenerator &) = delete;
+    CGenerator &operator=(const CGenerator &) = delete;
+    CGenerator &operator=(CGenerator &&Other) noexcept {
+        if (this != &Other) {
+            if (m_Handle)
+                m_Handle.destroy();
+            m_Handle = std::exchange(Other.m_Handle, {});
+        }
+        return *this;
+    }
+
+    ~CGenerator() {
+        if (m_Handle)
+            m_Handle.destroy();
+    }
+
+    CIterator begin() {
+        CIterator It(m_Handle);
+        ++It;
+        return It;
+    }
+
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    Handle m_Handle;
+};
+
+/**
+ * @brief One "key = value" line of a duration config
+ *
+ * Views point into the fed chunk or the reader's carry-over buffer and are only valid
+ * until the generator that produced the entry is resumed.
+ */
+struct SConfigEntry {
+    std::string_view m_Key;
+    std::string_view m_RawValue;
+    CTimePeriod m_Value;
+    bool m_Valid = false; // false if the value overflowed or was malformed ISO 8601
+};
+
+namespace detail {
+    [[nodiscard]] constexpr std::string_view TrimConfig(std::string_view Text) noexcept {
+        constexpr std::string_view Whitespace = " \t\r\f\v";
+        const size_t First = Text.find_first_not_of(Whitespace);
+        if (First == std::string_view::npos)
+            return {};
+        const size_t Last = Text.find_last_not_of(Whitespace);
+        return Text.substr(First, Last - First + 1);
+    }
+
+    // Splits "key = value", skipping blank lines, '#'/';' comments and lines without '='
+    [[nodiscard]] constexpr bool SplitConfigLine(const std::string_view Line, std::string_view &Key,
+                                                 std::string_view &Value) noexcept {
+        const std::string_view Trimmed = TrimConfig(Line);
+        if (Trimmed.empty() || Trimmed.front() == '#' || Trimmed.front() == ';')
+            return false;
+        const size_t Equals = Trimmed.find('=');
+        if (Equals == std::string_view::npos)
+            return false;
+        Key = TrimConfig(Trimmed.substr(0, Equals));
+        Value = TrimConfig(Trimmed.substr(Equals + 1));
+        return !Key.empty();
+    }
+
+    // FNV-1a, only used to detect whether a value's text changed between loads
+    [[nodiscard]] constexpr uint64_t HashConfigValue(const std::string_view Text) noexcept {
+        uint64_t Hash = 14695981039346656037ull;
+        for (const char c: Text) {
+            Hash ^= static_cast<unsigned char>(c);
+            Hash *= 1099511628211ull;
+        }
+        return Hash;
+    }
+
+    struct SConfigKeyHash {
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view Key) const noexcept {
+            return std::hash<std::string_view>{}(Key);
+        }
+    };
+
+    [[nodiscard]] inline SConfigEntry ParseConfigValue(const std::string_view Key, const std::string_view Raw) noexcept {
+        SConfigEntry Entry{Key, Raw, CTimePeriod(), false};
+        std::chrono::seconds Value{0};
+        if (TryParseDuration(Raw, Value)) {
+            Entry.m_Value = CTimePeriod(Value);
+            Entry.m_Valid = true;
+        }
+        return Entry;
+    }
+} // namespace detail
+
+/**
+ * @brief Splits arbitrarily sized chunks into lines, carrying incomplete lines over to the next chunk
+ */
+class CConfigLineReader final {
+    std::string m_Pending;
+
+public:
+    /**
+     * @brief Lazily yield every line completed by Chunk
+     *
+     * @param Chunk Newly arrived bytes, must stay alive while the generator is iterated
+     */
+    CGenerator<std::string_view> Lines(const std::string_view Chunk) {
+        size_t Start = 0;
+        if (!m_Pending.empty()) {
+            const size_t Newline = Chunk.find('\n');
+            if (Newline == std::string_view::npos) {
+                m_Pending.append(Chunk);
+                co_return;
+            }
+            m_Pending.append(Chunk.substr(0, Newline));
+            co_yield std::string_view(m_Pending);
+            m_Pending.clear();
+            Start = Newline + 1;
+        }
+
+        for (size_t Newline = Chunk.find('\n', Start); Newline != std::string_view::npos;
+             Newline = Chunk.find('\n', Start)) {
+            co_yield Chunk.substr(Start, Newline - Start);
+            Start = Newline + 1;
+        }
+        m_Pending.assign(Chunk.substr(Start));
+    }
+
+    /**
+     * @brief Yield the last line if the input did not end with a newline
+     */
+    CGenerator<std::string_view> Flush() {
+        if (!m_Pending.empty())
+            co_yield std::string_view(m_Pending);
+        m_Pending.clear();
+    }
+};
+
+/**
+ * @brief Incremental "key = value" duration config parser
+ *
+ * Values use either the native or the ISO 8601 grammar (see TryParseDuration).
+ *
+ * @code
+ * CConfigParser Parser;
+ * while (auto Chunk = Socket.Read())
+ *     for (const auto &Entry: Parser.Feed(Chunk))
+ *         Apply(Entry.m_Key, Entry.m_Value);
+ * for (const auto &Entry: Parser.Finish())
+ *     Apply(Entry.m_Key, Entry.m_Value);
+ * @endcode
+ */
+class CConfigParser final {
+    CConfigLineReader m_Lines;
+
+    CGenerator<SConfigEntry> Parse(CGenerator<std::string_view> Lines) {
+        for (const std::string_view Line: Lines) {
+            std::string_view Key, Raw;
+            if (detail::SplitConfigLine(Line, Key, Raw))
+                co_yield detail::ParseConfigValue(Key, Raw);
+        }
+    }
+
+public:
+    /**
+     * @brief Yield the entries of every line completed by Chunk
+     *
+     * @param Chunk Newly arrived bytes, must stay alive while the generator is iterated
+     */
+    CGenerator<SConfigEntry> Feed(const std::string_view Chunk) {
+        return Parse(m_Lines.Lines(Chunk));
+    }
+
+    /**
+     * @brief Yield the entry of a trailing line without newline, if any
+     */
+    CGenerator<SConfigEntry> Finish() {
+        return Parse(m_Lines.Flush());
+    }
+};
+
+enum class EConfigChange {
+    ADDED,
+    CHANGED,
+    REMOVED,
+};
+
+/**
+ * @brief A key whose value differs from the previous load
+ *
+ * For REMOVED, m_Value holds the last known value.
+ */
+struct SConfigChange {
+    std::string_view m_Key;
+    CTimePeriod m_Value;
+    EConfigChange m_Kind = EConfigChange::ADDED;
+    bool m_Valid = false;
+};
+
+/**
+ * @brief Incremental config reloader that only reparses values whose text changed
+ *
+ * Each load is a sequence of Feed() calls followed by Finish(). Values whose raw text
+ * hashes the same as in the previous load are not parsed again and not reported.
+ */
+class CConfigDiff final {
+    struct SCachedValue {
+        uint64_t m_Hash = 0;
+        CTimePeriod m_Value;
+        bool m_Valid = false;
+        uint64_t m_Generation = 0;
+    };
+
+    using ValueMap = std::unordered_map<std::string, SCachedValue, detail::SConfigKeyHash, std::equal_to<>>;
+
+    CConfigLineReader m_Lines;
+    ValueMap m_Values;
+    // Entry seen at each position of the previous load; reloads mostly keep the key order,
+    // so checking the same position first avoids hashing the key and a random map probe
+    std::vector<ValueMap::value_type *> m_vpOrder;
+    size_t m_Position = 0;
+    uint64_t m_Generation = 1;
+    size_t m_Parsed = 0;
+    size_t m_Reused = 0;
+
+    CGenerator<SConfigChange> Apply(CGenerator<std::string_view> Lines) {
+        for (const std::string_view Line: Lines) {
+            std::string_view Key, Raw;
+            if (!detail::SplitConfigLine(Line, Key, Raw))
+                continue;
+
+            const uint64_t Hash = detail::HashConfigValue(Raw);
+            ValueMap::value_type *pEntry = nullptr;
+            if (m_Position < m_vpOrder.size() && m_vpOrder[m_Position]->first == Key) {
+                pEntry = m_vpOrder[m_Position];
+            } else if (const auto It = m_Values.find(Key); It != m_Values.end()) {
+                pEntry = &*It;
+            }
+
+            if (m_Position == m_vpOrder.size())
+                m_vpOrder.push_back(nullptr);
+            ++m_Position;
+
+            if (pEntry && pEntry->second.m_Hash == Hash) {
+                pEntry->second.m_Generation = m_Generation;
+                m_vpOrder[m_Position - 1] = pEntry;
+                ++m_Reused;
+                continue;
+            }
+
+            const SConfigEntry Entry = detail::ParseConfigValue(Key, Raw);
+            ++m_Parsed;
+            const bool Added = pEntry == nullptr;
+            if (Added)
+                pEntry = &*m_Values.emplace(std::string(Key), SCachedValue()).first;
+            pEntry->second = {Hash, Entry.m_Value, Entry.m_Valid, m_Generation};
+            m_vpOrder[m_Position - 1] = pEntry;
+            co_yield SConfigChange{pEntry->first, Entry.m_Value, Added ? EConfigChange::ADDED : EConfigChange::CHANGED,
+                                   Entry.m_Valid};
+        }
+    }
+
+    CGenerator<SConfigChange> Complete() {
+        for (const auto &Change: Apply(m_Lines.Flush()))
+            co_yield Change;
+
+        // Entries beyond this load's line count may be about to be erased
+        m_vpOrder.resize(m_Position);
+        m_Position = 0;
+        for (auto It = m_Values.begin(); It != m_Values.end();) {
+            if (It->second.m_Generation == m_Generation) {
+                ++It;
+                continue;
+            }
+            co_yield SConfigChange{It->first, It->second.m_Value, EConfigChange::REMOVED, It->second.m_Valid};
+            It = m_Values.erase(It);
+        }
+        ++m_Generation;
+    }
+
+public:
+    /**
+     * @brief Yield changes for every line completed by Chunk
+     *
+     * @param Chunk Newly arrived bytes, must stay alive while the generator is iterated
+     */
+    CGenerator<SConfigChange> Feed(const std::string_view Chunk) {
+        return Apply(m_Lines.Lines(Chunk));
+    }
+
+    /**
+     * @brief End the current load: yield the trailing line's change and all removed keys
+     *
+     * The generator must be iterated to the end for the load to be committed.
+     */
+    CGenerator<SConfigChange> Finish() {
+        return Complete();
+    }
+
+    /**
+     * @brief Look up the current value of a key
+     *
+     * @param Key Config key
+     * @return Pointer to the value, nullptr if absent or invalid
+     */
+    [[nodiscard]] const CTimePeriod *Find(const std::string_view Key) const {
+        const auto It = m_Values.find(Key);
+        return It != m_Values.end() && It->second.m_Valid ? &It->second.m_Value : nullptr;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return m_Values.size(); }
+    [[nodiscard]] size_t parsedCount() const noexcept { return m_Parsed; }
+    [[nodiscard]] size_t reusedCount() const noexcept { return m_Reused; }
+};
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_HAS_COROUTINES
+
+#endif // TIMEDURATION_CONFIG_HPP
@@ -0,0 +1,341 @@
+#ifndef TIMEDURATION_CORE_HPP
+#define TIMEDURATION_CORE_HPP
+
+#include <timeduration/timeduration_fwd.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd> // declares std::string for the formatting members
+#include <string_view>
+
+/**
+ * CTimePeriod as a value type: construction from components or seconds, accessors and
+ * comparisons. Parsing members are defined in <timeduration/parse.hpp> (along with the
+ * scanner and its unit tables) and formatting members in <timeduration/format.hpp>;
+ * <timeduration/timeduration.hpp> includes all three.
+ */
+namespace timeduration {
+
+/**
+ * @brief Bounds for parsing untrusted input
+ *
+ * Inputs longer than m_MaxLength bytes are rejected before they are scanned or copied,
+ * and parsing stops as soon as more than m_MaxTokens numbers have been seen.
+ */
+struct SParseLimits {
+    size_t m_MaxLength = static_cast<size_t>(-1);
+    size_t m_MaxTokens = static_cast<size_t>(-1);
+};
+
+/**
+ * @brief Generous limits for internet-facing input: 256 bytes, 32 numbers
+ */
+inline constexpr SParseLimits UNTRUSTED_INPUT_LIMITS{256, 32};
+
+/**
+ * @brief Units of the native grammar
+ */
+enum ENativeUnit {
+    UNIT_SECONDS = 0,
+    UNIT_MINUTES,
+    UNIT_HOURS,
+    UNIT_DAYS,
+    UNIT_MONTHS, // 28 days when flattened to seconds
+    UNIT_YEARS,  // 365 days when flattened to seconds
+    NUM_NATIVE_UNITS
+};
+
+inline constexpr int64_t NATIVE_UNIT_SECONDS[NUM_NATIVE_UNITS]{1L, 60L, 3600L, 86400L, 2419200L, 31536000L};
+
+/**
+ * @brief A parsed duration as the user wrote it, one slot per native unit
+ *
+ * "90m 2h" keeps 90 in UNIT_MINUTES and 2 in UNIT_HOURS; repeated units are summed and bare
+ * numbers land in UNIT_MINUTES. Filled by CTimePeriod::TryParseComponents, which guarantees
+ * that duration() does not overflow.
+ */
+struct SParsedComponents {
+    int64_t m_aValues[NUM_NATIVE_UNITS]{};
+
+    [[nodiscard]] constexpr int64_t &operator[](const ENativeUnit Unit) noexcept { return m_aValues[Unit]; }
+    [[nodiscard]] constexpr int64_t operator[](const ENativeUnit Unit) const noexcept { return m_aValues[Unit]; }
+
+    /**
+     * @brief Total length, months and years flattened like Parse does
+     */
+    [[nodiscard]] constexpr std::chrono::seconds duration() const noexcept {
+        int64_t Total = 0;
+        for (size_t i = 0; i < NUM_NATIVE_UNITS; ++i)
+            Total += m_aValues[i] * NATIVE_UNIT_SECONDS[i];
+        return std::chrono::seconds(Total);
+    }
+
+    /**
+     * @brief Whether the slots already are the days/hours/minutes/seconds breakdown of duration()
+     *
+     * @return true if there are no months or years and seconds, minutes and hours are in range
+     */
+    [[nodiscard]] constexpr bool isNormalized() const noexcept {
+        return m_aValues[UNIT_MONTHS] == 0 && m_aValues[UNIT_YEARS] == 0 && m_aValues[UNIT_DAYS] >= 0 &&
+               static_cast<uint64_t>(m_aValues[UNIT_HOURS]) < 24 && static_cast<uint64_t>(m_aValues[UNIT_MINUTES]) < 60 &&
+               static_cast<uint64_t>(m_aValues[UNIT_SECONDS]) < 60;
+    }
+};
+
+/**
+ * @brief CTimePeriod class represents a time duration with parsing capabilities
+ *
+ * This class allows parsing of human-readable time durations (like "5h 30m") into
+ * chrono::seconds and provides methods to access the parsed components.
+ */
+class CTimePeriod final {
+    typedef std::chrono::duration<int64_t, std::ratio_multiply<std::ratio<24>, std::chrono::hours::period>> chrono_day; // added in C++20
+
+    std::chrono::seconds m_TotalDuration{0};
+    int64_t m_Days{0};
+    int64_t m_Hours{0};
+    int64_t m_Minutes{0};
+    int64_t m_Seconds{0};
+
+    template<typename AllocatorT>
+    [[nodiscard]] static std::chrono::seconds ParseWith(std::string_view from, const AllocatorT &Allocator,
+                                                        const SParseLimits &Limits = SParseLimits());
+
+    template<typename StringT>
+    static void AppendNumber(StringT &Out, int64_t Value);
+
+    template<typename StringT>
+    [[nodiscard]] StringT FormatString(StringT Result) const;
+
+    template<typename StringT>
+    [[nodiscard]] StringT FormatSqlInterval(StringT Result) const;
+
+    void Validate() {
+        // Store the normalized values
+        auto TotalSeconds = m_TotalDuration.count();
+
+        m_Days = TotalSeconds / 86400L;
+        TotalSeconds %= 86400L;
+
+        m_Hours = TotalSeconds / 3600L;
+        TotalSeconds %= 3600L;
+
+        m_Minutes = TotalSeconds / 60L;
+        m_Seconds = TotalSeconds % 60L;
+    }
+
+public:
+    /**
+     * @brief Construct a CTimePeriod with explicit duration components
+     *
+     * @param seconds Number of seconds
+     * @param minutes Number of minutes
+     * @param hours Number of hours
+     * @param days Number of days
+     */
+    explicit CTimePeriod(const int64_t seconds = 0, const int64_t minutes = 0, const int64_t hours = 0,
+                         const int64_t days = 0) {
+        m_TotalDuration = std::chrono::seconds{seconds} +
+                          std::chrono::minutes{minutes} +
+                          std::chrono::hours{hours} +
+                          chrono_day{days};
+        Validate();
+    }
+
+    /**
+     * @brief Construct a CTimePeriod by parsing a string (defined in parse.hpp)
+     *
+     * @param from String representation of time duration (e.g., "5h 30m 10s")
+     */
+    inline explicit CTimePeriod(std::string_view from);
+
+    /**
+     * @brief Construct a CTimePeriod from parsed components
+     *
+     * Normalized components (see SParsedComponents::isNormalized) are taken over as they are,
+     * anything else is flattened and normalized like the other constructors do.
+     *
+     * @param Components Per-unit values, e.g. from TryParseComponents
+     */
+    explicit CTimePeriod(const SParsedComponents &Components) {
+        m_TotalDuration = Components.duration();
+        if (!Components.isNormalized()) {
+            Validate();
+            return;
+        }
+        m_Days = Components[UNIT_DAYS];
+        m_Hours = Components[UNIT_HOURS];
+        m_Minutes = Components[UNIT_MINUTES];
+        m_Seconds = Components[UNIT_SECONDS];
+    }
+
+    /**
+     * @brief Construct a CTimePeriod from std::chrono::seconds
+     *
+     * @param duration Duration in seconds
+     */
+    explicit CTimePeriod(const std::chrono::seconds duration) {
+        m_TotalDuration = duration;
+        Validate();
+    }
+
+    /**
+     * @brief Parse a string into chrono::seconds (defined in parse.hpp)
+     *
+     * @param from String representation of time duration
+     * @return std::chrono::seconds Parsed duration in seconds
+     */
+    [[nodiscard]] inline static std::chrono::seconds Parse(std::string_view from);
+
+    /**
+     * @brief Parse a string into chrono::seconds, allocating only from Resource (defined in parse.hpp)
+     *
+     * ResourceT is std::pmr::memory_resource or a class derived from it; it is a template
+     * parameter only so that this header does not need <memory_resource>.
+     *
+     * @param from String representation of time duration
+     * @param Resource Memory resource for the scanner and its unit table (e.g. a per-request arena)
+     * @return std::chrono::seconds Parsed duration in seconds
+     */
+    template<typename ResourceT>
+    [[nodiscard]] static std::chrono::seconds Parse(std::string_view from, ResourceT *Resource);
+
+    /**
+     * @brief Parse a string into chrono::seconds within Limits (defined in parse.hpp)
+     *
+     * @param from String representation of time duration
+     * @param Limits Maximum input length and number count
+     * @return std::chrono::seconds Parsed duration in seconds
+     * @throws std::length_error if a limit is exceeded, std::out_of_range if a number or the total overflows
+     */
+    [[nodiscard]] inline static std::chrono::seconds Parse(std::string_view from, const SParseLimits &Limits);
+
+    /**
+     * @brief Parse a string into chrono::seconds without allocating or throwing (defined in parse.hpp)
+     *
+     * Accepts exactly the grammar of Parse (bare numbers count as minutes, unknown units
+     * are ignored, repeated units are summed) using the built-in unit table.
+     *
+     * @param from String representation of time duration
+     * @param Out Receives the parsed duration on success
+     * @return false if a value or the total overflows int64_t seconds
+     */
+    [[nodiscard]] inline static bool TryParse(std::string_view from, std::chrono::seconds &Out) noexcept;
+
+    /**
+     * @brief TryParse within Limits, O(1) rejection of oversized input (defined in parse.hpp)
+     *
+     * @param from String representation of time duration
+     * @param Out Receives the parsed duration on success
+     * @param Limits Maximum input length and number count
+     * @return false if a limit is exceeded or a value or the total overflows int64_t seconds
+     */
+    [[nodiscard]] inline static bool TryParse(std::string_view from, std::chrono::seconds &Out,
+                                              const SParseLimits &Limits) noexcept;
+
+    /**
+     * @brief Parse a string into per-unit components without allocating or throwing (defined in parse.hpp)
+     *
+     * Same grammar and failure cases as TryParse, but the values stay in the unit they were
+     * written in instead of being summed into seconds.
+     *
+     * @param from String representation of time duration
+     * @param Out Receives the components on success
+     * @param Limits Maximum input length and number count
+     * @return false if a limit is exceeded or a value or the total overflows int64_t seconds
+     */
+    [[nodiscard]] inline static bool TryParseComponents(std::string_view from, SParsedComponents &Out,
+                                                        const SParseLimits &Limits = SParseLimits()) noexcept;
+
+    /**
+     * @brief Factory method to create a CTimePeriod from a string (defined in parse.hpp)
+     *
+     * @param from String representation of time duration
+     * @return CTimePeriod object
+     */
+    [[nodiscard]] inline static CTimePeriod ParseFactory(std::string_view from);
+
+    /**
+     * @brief Generate SQL interval string representation (defined in format.hpp)
+     *
+     * @return std::string SQL compatible interval string
+     */
+    [[nodiscard]] inline std::string asSqlInterval() const;
+
+    /**
+     * @brief Generate SQL interval string representation, allocating only from Resource (defined in format.hpp)
+     *
+     * @param Resource Memory resource for the returned string
+     * @return std::pmr::string SQL compatible interval string (deduced, so this header does not need <string>)
+     */
+    template<typename ResourceT>
+    [[nodiscard]] auto asSqlInterval(ResourceT *Resource) const;
+
+    [[nodiscard]] constexpr std::chrono::seconds duration() const noexcept { return m_TotalDuration; }
+    [[nodiscard]] constexpr int64_t days() const noexcept { return m_Days; }
+    [[nodiscard]] constexpr int64_t hours() const noexcept { return m_Hours; }
+    [[nodiscard]] constexpr int64_t minutes() const noexcept { return m_Minutes; }
+    [[nodiscard]] constexpr int64_t seconds() const noexcept { return m_Seconds; }
+
+    /**
+     * @brief Format as human-readable string (defined in format.hpp)
+     *
+     * @return std::string Formatted string (e.g., "2d 5h 30m 15s")
+     */
+    [[nodiscard]] inline std::string toString() const;
+
+    /**
+     * @brief Format as human-readable string, allocating only from Resource (defined in format.hpp)
+     *
+     * @param Resource Memory resource for the returned string
+     * @return std::pmr::string Formatted string (e.g., "2d 5h 30m 15s"), deduced like asSqlInterval's
+     */
+    template<typename ResourceT>
+    [[nodiscard]] auto toString(ResourceT *Resource) const;
+
+    /**
+     * @brief Check if duration is zero
+     *
+     * @return true if duration is zero
+     */
+    [[nodiscard]] constexpr bool isZero() const noexcept {
+        return m_TotalDuration.count() == 0;
+    }
+
+    // Comparison operators
+
+    friend bool operator==(const CTimePeriod& Lhs, const CTimePeriod& Rhs)
+    {
+        return Lhs.m_TotalDuration == Rhs.m_TotalDuration;
+    }
+
+    friend bool operator!=(const CTimePeriod& Lhs, const CTimePeriod& Rhs)
+    {
+        return !(Lhs == Rhs);
+    }
+
+    friend bool operator<(const CTimePeriod& Lhs, const CTimePeriod& Rhs)
+    {
+        return Lhs.m_TotalDuration < Rhs.m_TotalDuration;
+    }
+
+    friend bool operator<=(const CTimePeriod& Lhs, const CTimePeriod& Rhs)
+    {
+        return Lhs.m_TotalDuration <= Rhs.m_TotalDuration;
+    }
+
+    friend bool operator>(const CTimePeriod& Lhs, const CTimePeriod& Rhs)
+    {
+        return Lhs.m_TotalDuration > Rhs.m_TotalDuration;
+    }
+
+    friend bool operator>=(const CTimePeriod& Lhs, const CTimePeriod& Rhs)
+    {
+        return Lhs.m_TotalDuration >= Rhs.m_TotalDuration;
+    }
+};
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_CORE_HPP
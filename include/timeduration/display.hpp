@@ -0,0 +1,246 @@
+#ifndef TIMEDURATION_DISPLAY_HPP
+#define TIMEDURATION_DISPLAY_HPP
+
+#include <timeduration/core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+
+namespace timeduration {
+
+/**
+ * @brief Output form of FormatDisplay
+ */
+enum class EDisplayStyle {
+    COMPACT, // "2d 5h 30m 15s", like toString
+    LONG,    // "2 days 5 hours 30 minutes 15 seconds"
+    CLOCK,   // "53:30:15", hours are not wrapped into days
+};
+
+struct SDisplayOptions {
+    EDisplayStyle m_Style = EDisplayStyle::COMPACT;
+    // Keep only the largest N non-zero units, rounding half up on the last one ("~2d 6h"); 0 keeps all
+    size_t m_MaxUnits = 0;
+    // Emit years (365 days) and months (28 days) the way Parse reads "y" and "mo"
+    bool m_CalendarUnits = false;
+};
+
+// Longest output of FormatDisplay is 69 bytes: "~-292471208677 years 13 months 27 days 23 hours 59 minutes 59 seconds"
+inline constexpr size_t DISPLAY_MAX_LENGTH = 80;
+
+namespace detail {
+    // Unit names are copied as one 8-byte block and the cursor advanced by m_Length, so the
+    // formatter may write up to 7 bytes past the text; DISPLAY_MAX_LENGTH leaves room for that
+    struct SDisplayText {
+        std::array<char, 8> m_aText{};
+        size_t m_Length;
+
+        template<size_t N>
+        constexpr SDisplayText(const char (&Text)[N]) noexcept : m_Length(N - 1) {
+            static_assert(N - 1 <= 8, "unit names are copied in 8-byte blocks");
+            for (size_t i = 0; i + 1 < N; ++i)
+                m_aText[i] = Text[i];
+        }
+    };
+
+    struct SDisplayUnit {
+        ENativeUnit m_Unit;
+        SDisplayText m_Short;
+        SDisplayText m_Singular;
+        SDisplayText m_Plural;
+    };
+
+    // Largest first; the first two are skipped unless calendar units are requested
+    inline constexpr std::array<SDisplayUnit, NUM_NATIVE_UNITS> DISPLAY_UNITS{{
+        {UNIT_YEARS, "y", " year", " years"},
+        {UNIT_MONTHS, "mo", " month", " months"},
+        {UNIT_DAYS, "d", " day", " days"},
+        {UNIT_HOURS, "h", " hour", " hours"},
+        {UNIT_MINUTES, "m", " minute", " minutes"},
+        {UNIT_SECONDS, "s", " second", " seconds"},
+    }};
+    inline constexpr size_t DISPLAY_FIRST_EXACT_UNIT = 2;
+
+    // "00" "01" ... "99", so numbers are written two digits per division
+    inline constexpr std::array<char, 200> DIGIT_PAIRS = [] {
+        std::array<char, 200> aPairs{};
+        for (int i = 0; i < 100; ++i) {
+            aPairs[2 * i] = static_cast<char>('0' + i / 10);
+            aPairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+        }
+        return aPairs;
+    }();
+
+    [[nodiscard]] constexpr size_t DigitCount(uint64_t Value) noexcept {
+        size_t Count = 1;
+        for (; Value >= 100; Value /= 100)
+            Count += 2;
+        return Count + (Value >= 10);
+    }
+
+    // Writes Value in decimal starting at Out, returns the end
+    inline char *WriteDigitPairs(char *Out, uint64_t Value) noexcept {
+        char *const End = Out + DigitCount(Value);
+        char *Cursor = End;
+        for (; Value >= 100; Value /= 100) {
+            Cursor -= 2;
+            std::copy_n(&DIGIT_PAIRS[2 * (Value % 100)], 2, Cursor);
+        }
+        if (Value >= 10)
+            std::copy_n(&DIGIT_PAIRS[2 * Value], 2, Cursor - 2);
+        else
+            Cursor[-1] = static_cast<char>('0' + Value);
+        return End;
+    }
+
+    inline char *WriteText(char *Out, const SDisplayText &Text) noexcept {
+        std::copy_n(Text.m_aText.data(), Text.m_aText.size(), Out);
+        return Out + Text.m_Length;
+    }
+
+    inline char *WriteClock(char *Out, const uint64_t Magnitude) noexcept {
+        const uint64_t Minutes = Magnitude / 60;
+        Out = WriteDigitPairs(Out, Minutes / 60);
+        *Out++ = ':';
+        Out = std::copy_n(&DIGIT_PAIRS[2 * (Minutes % 60)], 2, Out);
+        *Out++ = ':';
+        return std::copy_n(&DIGIT_PAIRS[2 * (Magnitude % 60)], 2, Out);
+    }
+
+    // Greedy split of Magnitude over DISPLAY_UNITS[First..], counts in DISPLAY_UNITS order.
+    // Spelled out so that every division is by a constant and compiles to a multiplication.
+    [[nodiscard]] constexpr std::array<uint64_t, NUM_NATIVE_UNITS> SplitDisplayUnits(uint64_t Magnitude,
+                                                                                    const size_t First) noexcept {
+        static_assert(DISPLAY_UNITS[0].m_Unit == UNIT_YEARS && DISPLAY_UNITS[5].m_Unit == UNIT_SECONDS);
+        std::array<uint64_t, NUM_NATIVE_UNITS> aCounts{};
+        if (First == 0) {
+            aCounts[0] = Magnitude / NATIVE_UNIT_SECONDS[UNIT_YEARS];
+            Magnitude %= NATIVE_UNIT_SECONDS[UNIT_YEARS];
+            aCounts[1] = Magnitude / NATIVE_UNIT_SECONDS[UNIT_MONTHS];
+            Magnitude %= NATIVE_UNIT_SECONDS[UNIT_MONTHS];
+        }
+        aCounts[2] = Magnitude / NATIVE_UNIT_SECONDS[UNIT_DAYS];
+        const auto Seconds = static_cast<uint32_t>(Magnitude % NATIVE_UNIT_SECONDS[UNIT_DAYS]);
+        aCounts[3] = Seconds / 3600;
+        aCounts[4] = Seconds / 60 % 60;
+        aCounts[5] = Seconds % 60;
+        return aCounts;
+    }
+} // namespace detail
+
+/**
+ * @brief Write a duration for humans into a caller buffer
+ *
+ * COMPACT and LONG list the non-zero units from largest to smallest ("0s" / "0 seconds" for
+ * zero). With m_MaxUnits set, the output keeps that many units starting at the largest
+ * non-zero one, rounds the rest half up into the last kept unit and starts with '~' if the
+ * result is not exact. CLOCK writes "H:MM:SS" and ignores the other options. Negative
+ * durations get a leading '-'.
+ *
+ * @param Duration Duration to format
+ * @param Buffer Destination, DISPLAY_MAX_LENGTH bytes always suffice
+ * @param Options Style, rounding and units
+ * @return size_t Number of characters written, 0 if the buffer is too small
+ */
+[[nodiscard]] inline size_t FormatDisplay(const std::chrono::seconds Duration, const std::span<char> Buffer,
+                                          const SDisplayOptions &Options = SDisplayOptions()) noexcept {
+    const int64_t Count = Duration.count();
+    const uint64_t Magnitude = Count < 0 ? 0 - static_cast<uint64_t>(Count) : static_cast<uint64_t>(Count);
+
+    // Large enough buffers are written directly, others through a scratch copy
+    char Scratch[DISPLAY_MAX_LENGTH];
+    char *const Begin = Buffer.size() >= DISPLAY_MAX_LENGTH ? Buffer.data() : Scratch;
+    char *Out = Begin;
+
+    if (Options.m_Style == EDisplayStyle::CLOCK) {
+        if (Count < 0)
+            *Out++ = '-';
+        Out = detail::WriteClock(Out, Magnitude);
+    } else {
+        const size_t First = Options.m_CalendarUnits ? 0 : detail::DISPLAY_FIRST_EXACT_UNIT;
+        auto aCounts = detail::SplitDisplayUnits(Magnitude, First);
+
+        uint64_t Shown = Magnitude;
+        if (Options.m_MaxUnits != 0) {
+            size_t Largest = First;
+            while (Largest + 1 < aCounts.size() && aCounts[Largest] == 0)
+                ++Largest;
+            const size_t Last = std::min(Largest + Options.m_MaxUnits, aCounts.size()) - 1;
+
+            // Truncate below Last, then round half up; stays below 2^64 since Magnitude <= 2^63
+            const auto LastSeconds = static_cast<uint64_t>(NATIVE_UNIT_SECONDS[detail::DISPLAY_UNITS[Last].m_Unit]);
+            Shown = 0;
+            for (size_t i = First; i <= Last; ++i)
+                Shown += aCounts[i] * static_cast<uint64_t>(NATIVE_UNIT_SECONDS[detail::DISPLAY_UNITS[i].m_Unit]);
+            if (2 * (Magnitude - Shown) >= LastSeconds)
+                Shown += LastSeconds;
+
+            // A carry can reach a larger unit; years are not a whole number of months, so drop
+            // whatever would exceed the unit budget after re-splitting
+            aCounts = detail::SplitDisplayUnits(Shown, First);
+            size_t Kept = 0;
+            for (size_t i = First; i < aCounts.size(); ++i) {
+                if (aCounts[i] != 0 && Kept++ >= Options.m_MaxUnits) {
+                    Shown -= aCounts[i] * static_cast<uint64_t>(NATIVE_UNIT_SECONDS[detail::DISPLAY_UNITS[i].m_Unit]);
+                    aCounts[i] = 0;
+                }
+            }
+            if (Shown != Magnitude)
+                *Out++ = '~';
+        }
+        if (Count < 0 && Shown != 0)
+            *Out++ = '-';
+
+        const bool Long = Options.m_Style == EDisplayStyle::LONG;
+        const char *const Start = Out;
+        for (size_t i = First; i < aCounts.size(); ++i) {
+            // Zero is written with the smallest unit
+            if (aCounts[i] == 0 && (Out != Start || i + 1 != aCounts.size()))
+                continue;
+            if (Out != Start)
+                *Out++ = ' ';
+            Out = detail::WriteDigitPairs(Out, aCounts[i]);
+            const auto &Unit = detail::DISPLAY_UNITS[i];
+            Out = detail::WriteText(Out, !Long ? Unit.m_Short : aCounts[i] == 1 ? Unit.m_Singular : Unit.m_Plural);
+        }
+    }
+
+    const auto Length = static_cast<size_t>(Out - Begin);
+    if (Begin == Scratch) {
+        if (Length > Buffer.size())
+            return 0;
+        std::copy(Scratch, Out, Buffer.data());
+    }
+    return Length;
+}
+
+/**
+ * @brief Format a CTimePeriod for humans (see FormatDisplay)
+ *
+ * @param Period Period to format
+ * @param Options Style, rounding and units
+ * @return std::string e.g. "2 days 5 hours", "~2d 6h" or "53:30:15"
+ */
+[[nodiscard]] inline std::string ToDisplayString(const CTimePeriod &Period, const SDisplayOptions &Options = SDisplayOptions()) {
+    char Buffer[DISPLAY_MAX_LENGTH];
+    return {Buffer, FormatDisplay(Period.duration(), Buffer, Options)};
+}
+
+/**
+ * @brief Format a CTimePeriod for humans, allocating only from Resource
+ */
+[[nodiscard]] inline std::pmr::string ToDisplayString(const CTimePeriod &Period, const SDisplayOptions &Options,
+                                                      std::pmr::memory_resource *Resource) {
+    char Buffer[DISPLAY_MAX_LENGTH];
+    return {Buffer, FormatDisplay(Period.duration(), Buffer, Options), Resource};
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_DISPLAY_HPP
@@ -0,0 +1,452 @@
+#ifndef TIMEDURATION_EXPRESSION_HPP
+#define TIMEDURATION_EXPRESSION_HPP
+
+#include <timeduration/ascii.hpp>
+#include <timeduration/parse.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace timeduration {
+
+namespace detail {
+    enum class EExpressionOp : uint8_t {
+        PUSH,        // push m_Operand
+        LOAD,        // push variable m_Operand
+        TO_DURATION, // top *= 60, a bare number used as a duration counts as minutes
+        NEGATE,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE,
+        MIN,
+        MAX,
+    };
+
+    struct SExpressionInstruction {
+        EExpressionOp m_Op;
+        int64_t m_Operand = 0;
+    };
+
+    // Deepest evaluation stack a compiled expression may need, checked by the compiler
+    inline constexpr size_t EXPRESSION_MAX_STACK = 32;
+    // Deepest nesting of parentheses, unary minus and min/max the compiler recurses into
+    inline constexpr size_t EXPRESSION_MAX_NESTING = 64;
+
+    /**
+     * Recursive descent compiler emitting postfix bytecode:
+     *
+     *   expr    := term (('+' | '-') term)*
+     *   term    := unary (('*' | '/') unary)*
+     *   unary   := '-' unary | primary
+     *   primary := literal | number | name | '(' expr ')' | ('min' | 'max') '(' expr (',' expr)+ ')'
+     *   literal := (number unit)+      e.g. "1h 30m", units of the native grammar
+     *
+     * Every value is either a duration or a plain number; the compiler tracks which and
+     * rejects mixes that make no sense (duration * duration, number / duration).
+     */
+    class CExpressionCompiler final {
+        std::string_view m_Source;
+        size_t m_Current = 0;
+        std::vector<SExpressionInstruction> &m_vCode;
+        std::vector<std::string> &m_vVariables;
+        size_t m_Depth = 0;
+        size_t m_Nesting = 0;
+
+        [[noreturn]] void Fail(const char *pWhat) const {
+            throw std::invalid_argument(std::string(pWhat) + " at offset " + std::to_string(m_Current));
+        }
+
+        static bool IsNameChar(const char c) { return IsAlphaAscii(c) || c == '_'; }
+
+        void SkipSpaces() {
+            while (m_Current < m_Source.size() && IsSpaceAscii(m_Source[m_Current]))
+                ++m_Current;
+        }
+
+        bool Accept(const char c) {
+            SkipSpaces();
+            if (m_Current < m_Source.size() && m_Source[m_Current] == c) {
+                ++m_Current;
+                return true;
+            }
+            return false;
+        }
+
+        void Expect(const char c) {
+            if (!Accept(c))
+                Fail(c == ')' ? "expected ')'" : "expected ','");
+        }
+
+        void Emit(const EExpressionOp Op, const int64_t Operand = 0) {
+            switch (Op) {
+                case EExpressionOp::PUSH:
+                case EExpressionOp::LOAD:
+                    if (++m_Depth > EXPRESSION_MAX_STACK)
+                        Fail("expression needs too deep a stack");
+                    break;
+                case EExpressionOp::TO_DURATION:
+                case EExpressionOp::NEGATE:
+                    break;
+                default:
+                    --m_Depth;
+            }
+            m_vCode.push_back({Op, Operand});
+        }
+
+        std::string_view Word() {
+            const size_t Start = m_Current;
+            while (m_Current < m_Source.size() && (IsNameChar(m_Source[m_Current]) || IsDigitAscii(m_Source[m_Current])))
+                ++m_Current;
+            return m_Source.substr(Start, m_Current - Start);
+        }
+
+        int64_t Number() {
+            int64_t Value = 0;
+            for (; m_Current < m_Source.size() && IsDigitAscii(m_Source[m_Current]); ++m_Current) {
+                const int Digit = m_Source[m_Current] - '0';
+                if (Value > (std::numeric_limits<int64_t>::max() - Digit) / 10)
+                    Fail("number too large");
+                Value = Value * 10 + Digit;
+            }
+            return Value;
+        }
+
+        // Parses one "<number><unit>" pair, or returns false (consuming nothing) for a bare number
+        bool UnitTerm(int64_t &Seconds) {
+            const size_t Start = m_Current;
+            const int64_t Value = Number();
+            size_t End = m_Current;
+            while (End < m_Source.size() && IsUnitChar(m_Source[End]))
+                ++End;
+            if (End == m_Current) {
+                m_Current = Start;
+                return false;
+            }
+
+            const std::string_view Literal = m_Source.substr(m_Current, End - m_Current);
+            const auto *pUnit = std::find_if(NATIVE_LITERALS.begin(), NATIVE_LITERALS.end(),
+                                             [Literal](const SNativeLiteral &Unit) { return Unit.m_Literal == Literal; });
+            if (pUnit == NATIVE_LITERALS.end())
+                Fail("unknown unit");
+            m_Current = End;
+            if (!CheckedMultiply(Value, NATIVE_UNIT_SECONDS[pUnit->m_Unit], Seconds))
+                Fail("duration too large");
+            return true;
+        }
+
+        // Returns true if the value left on the stack is a duration
+        bool Primary() {
+            SkipSpaces();
+            if (m_Current >= m_Source.size())
+                Fail("expected a value");
+            const char c = m_Source[m_Current];
+
+            if (IsDigitAscii(c)) {
+                int64_t Total = 0;
+                int64_t Seconds = 0;
+                if (!UnitTerm(Seconds)) {
+                    Emit(EExpressionOp::PUSH, Number());
+                    return false;
+                }
+                // "1h 30m" is one literal, as in the native grammar
+                do {
+                    if (!CheckedAdd(Total, Seconds, Total))
+                        Fail("duration too large");
+                    SkipSpaces();
+                } while (m_Current < m_Source.size() && IsDigitAscii(m_Source[m_Current]) && UnitTerm(Seconds));
+                Emit(EExpressionOp::PUSH, Total);
+                return true;
+            }
+
+            if (c == '(') {
+                ++m_Current;
+                const bool Duration = Expression();
+                Expect(')');
+                return Duration;
+            }
+
+            if (IsNameChar(c)) {
+                const std::string_view Name = Word();
+                if (Name == "min" || Name == "max") {
+                    if (!Accept('('))
+                        Fail("expected '('");
+                    const bool Duration = Expression();
+                    Expect(',');
+                    do {
+                        if (Expression() != Duration)
+                            Fail("min/max arguments mix durations and numbers");
+                        Emit(Name == "min" ? EExpressionOp::MIN : EExpressionOp::MAX);
+                    } while (Accept(','));
+                    Expect(')');
+                    return Duration;
+                }
+
+                const auto It = std::find(m_vVariables.begin(), m_vVariables.end(), Name);
+                Emit(EExpressionOp::LOAD, It - m_vVariables.begin());
+                if (It == m_vVariables.end())
+                    m_vVariables.emplace_back(Name);
+                return true;
+            }
+
+            Fail("expected a value");
+        }
+
+        bool Unary() {
+            // Untrusted input must not be able to exhaust the native stack
+            if (++m_Nesting > EXPRESSION_MAX_NESTING)
+                Fail("expression nested too deeply");
+            const bool Duration = UnaryNested();
+            --m_Nesting;
+            return Duration;
+        }
+
+        bool UnaryNested() {
+            if (Accept('-')) {
+                const bool Duration = Unary();
+                Emit(EExpressionOp::NEGATE);
+                return Duration;
+            }
+            return Primary();
+        }
+
+        bool Term() {
+            bool Duration = Unary();
+            for (;;) {
+                if (Accept('*')) {
+                    const bool Rhs = Unary();
+                    if (Duration && Rhs)
+                        Fail("cannot multiply two durations");
+                    Emit(EExpressionOp::MULTIPLY);
+                    Duration = Duration || Rhs;
+                } else if (Accept('/')) {
+                    if (Unary())
+                        Fail("can only divide by a number");
+                    Emit(EExpressionOp::DIVIDE);
+                } else {
+                    return Duration;
+                }
+            }
+        }
+
+        // Both operands of + and - as durations, bare numbers count as minutes
+        bool Expression() {
+            bool Duration = Term();
+            for (;;) {
+                const bool Add = Accept('+');
+                if (!Add && !Accept('-'))
+                    return Duration;
+                if (!Duration) {
+                    Emit(EExpressionOp::TO_DURATION);
+                    Duration = true;
+                }
+                if (!Term())
+                    Emit(EExpressionOp::TO_DURATION);
+                Emit(Add ? EExpressionOp::ADD : EExpressionOp::SUBTRACT);
+            }
+        }
+
+    public:
+        CExpressionCompiler(const std::string_view Source, std::vector<SExpressionInstruction> &vCode,
+                            std::vector<std::string> &vVariables) : m_Source(Source), m_vCode(vCode),
+                                                                    m_vVariables(vVariables) {
+        }
+
+        void Compile() {
+            if (!Expression())
+                Emit(EExpressionOp::TO_DURATION);
+            SkipSpaces();
+            if (m_Current != m_Source.size())
+                Fail("unexpected character");
+        }
+    };
+} // namespace detail
+
+/**
+ * @brief A duration expression compiled once into flat bytecode and evaluated without allocating
+ *
+ * Supports literals in the native grammar ("1h 30m"), +, -, * and / by integers, unary minus,
+ * parentheses, min(...) and max(...), and named variables bound at evaluation time:
+ * "2h - 15m", "3 * 10m", "max(base / 2, 5m) + jitter". A bare number multiplies or divides;
+ * used as a duration it counts as minutes like everywhere else in the library. Unlike the
+ * scanner, unknown units are errors. Expressions without variables are folded to a constant.
+ */
+class CExpression final {
+    std::vector<detail::SExpressionInstruction> m_vCode;
+    std::vector<std::string> m_vVariables;
+
+public:
+    /**
+     * @brief Compile an expression
+     *
+     * @param Source Expression text
+     * @return CExpression Compiled expression
+     * @throws std::invalid_argument with the offset of the error if Source is not a valid expression
+     */
+    [[nodiscard]] static CExpression Compile(const std::string_view Source) {
+        CExpression Result;
+        detail::CExpressionCompiler(Source, Result.m_vCode, Result.m_vVariables).Compile();
+
+        // Nothing to bind, evaluate now; on overflow keep the code so every evaluation reports it
+        if (std::chrono::seconds Value{0}; Result.m_vVariables.empty() && Result.TryEvaluate(Value))
+            Result.m_vCode.assign({{detail::EExpressionOp::PUSH, Value.count()}});
+        return Result;
+    }
+
+    /**
+     * @brief Names of the variables, in the order TryEvaluate expects their values
+     */
+    [[nodiscard]] std::span<const std::string> Variables() const noexcept {
+        return m_vVariables;
+    }
+
+    [[nodiscard]] size_t CodeSize() const noexcept {
+        return m_vCode.size();
+    }
+
+    /**
+     * @brief Evaluate without allocating or throwing
+     *
+     * @param Out Receives the result on success
+     * @param Values One value per entry of Variables(), in the same order
+     * @return false on overflow, division by zero or if fewer values than variables are given
+     */
+    [[nodiscard]] bool TryEvaluate(std::chrono::seconds &Out, const std::span<const std::chrono::seconds> Values = {}) const noexcept {
+        using detail::EExpressionOp;
+
+        if (Values.size() < m_vVariables.size())
+            return false;
+
+        std::array<int64_t, detail::EXPRESSION_MAX_STACK> aStack;
+        size_t Top = 0;
+        for (const auto &Instruction: m_vCode) {
+            switch (Instruction.m_Op) {
+                case EExpressionOp::PUSH:
+                    aStack[Top++] = Instruction.m_Operand;
+                    continue;
+                case EExpressionOp::LOAD:
+                    aStack[Top++] = Values[static_cast<size_t>(Instruction.m_Operand)].count();
+                    continue;
+                case EExpressionOp::TO_DURATION:
+                    if (!detail::CheckedMultiply(aStack[Top - 1], 60, aStack[Top - 1]))
+                        return false;
+                    continue;
+                case EExpressionOp::NEGATE:
+                    if (aStack[Top - 1] == std::numeric_limits<int64_t>::min())
+                        return false;
+                    aStack[Top - 1] = -aStack[Top - 1];
+                    continue;
+                default:
+                    break;
+            }
+
+            // Binary operators pop Rhs and replace Lhs
+            const int64_t Rhs = aStack[--Top];
+            int64_t &Lhs = aStack[Top - 1];
+            switch (Instruction.m_Op) {
+                case EExpressionOp::ADD:
+                    if (!detail::CheckedAdd(Lhs, Rhs, Lhs))
+                        return false;
+                    break;
+                case EExpressionOp::SUBTRACT:
+                    if (Rhs == std::numeric_limits<int64_t>::min() || !detail::CheckedAdd(Lhs, -Rhs, Lhs))
+                        return false;
+                    break;
+                case EExpressionOp::MULTIPLY:
+                    if (!detail::CheckedMultiply(Lhs, Rhs, Lhs))
+                        return false;
+                    break;
+                case EExpressionOp::DIVIDE:
+                    if (Rhs == 0 || (Rhs == -1 && Lhs == std::numeric_limits<int64_t>::min()))
+                        return false;
+                    Lhs /= Rhs;
+                    break;
+                case EExpressionOp::MIN:
+                    Lhs = std::min(Lhs, Rhs);
+                    break;
+                case EExpressionOp::MAX:
+                    Lhs = std::max(Lhs, Rhs);
+                    break;
+                default:
+                    break;
+            }
+        }
+        Out = std::chrono::seconds(aStack[0]);
+        return true;
+    }
+
+    /**
+     * @brief Evaluate (see TryEvaluate)
+     *
+     * @throws std::out_of_range on overflow, division by zero or missing variable values
+     */
+    [[nodiscard]] std::chrono::seconds Evaluate(const std::span<const std::chrono::seconds> Values = {}) const {
+        std::chrono::seconds Result{0};
+        if (!TryEvaluate(Result, Values))
+            throw std::out_of_range("duration expression cannot be evaluated");
+        return Result;
+    }
+};
+
+/**
+ * @brief Compiled expressions keyed by their source text, safe to share between threads
+ *
+ * Lookups of already compiled text take a shared lock and do not allocate.
+ */
+class CExpressionCache final {
+    struct STextHash {
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view Text) const noexcept {
+            return std::hash<std::string_view>{}(Text);
+        }
+    };
+
+    mutable std::shared_mutex m_Mutex;
+    std::unordered_map<std::string, std::shared_ptr<const CExpression>, STextHash, std::equal_to<>> m_Expressions;
+
+public:
+    /**
+     * @brief Compiled form of Source, compiling it on first use
+     *
+     * @throws std::invalid_argument if Source is not a valid expression (nothing is cached then)
+     */
+    [[nodiscard]] std::shared_ptr<const CExpression> Get(const std::string_view Source) {
+        {
+            const std::shared_lock Lock(m_Mutex);
+            if (const auto It = m_Expressions.find(Source); It != m_Expressions.end())
+                return It->second;
+        }
+        // Compile outside the lock; if two threads race, the first insert wins
+        auto pCompiled = std::make_shared<const CExpression>(CExpression::Compile(Source));
+        const std::unique_lock Lock(m_Mutex);
+        return m_Expressions.try_emplace(std::string(Source), std::move(pCompiled)).first->second;
+    }
+
+    [[nodiscard]] size_t size() const {
+        const std::shared_lock Lock(m_Mutex);
+        return m_Expressions.size();
+    }
+
+    void Clear() {
+        const std::unique_lock Lock(m_Mutex);
+        m_Expressions.clear();
+    }
+};
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_EXPRESSION_HPP
@@ -0,0 +1,62 @@
+#ifndef TIMEDURATION_FORMAT_HPP
+#define TIMEDURATION_FORMAT_HPP
+
+#include <timeduration/core.hpp>
+
+#include <charconv>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+namespace timeduration {
+
+template<typename StringT>
+void CTimePeriod::AppendNumber(StringT &Out, const int64_t Value) {
+    char Buffer[24];
+    const auto End = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value).ptr;
+    Out.append(Buffer, End);
+}
+
+template<typename StringT>
+StringT CTimePeriod::FormatString(StringT Result) const {
+    if (m_Days > 0) { AppendNumber(Result, m_Days); Result += "d "; }
+    if (m_Hours > 0) { AppendNumber(Result, m_Hours); Result += "h "; }
+    if (m_Minutes > 0) { AppendNumber(Result, m_Minutes); Result += "m "; }
+    if (m_Seconds > 0 || Result.empty()) { AppendNumber(Result, m_Seconds); Result += "s"; }
+    if (!Result.empty() && Result.back() == ' ')
+        Result.pop_back();
+    return Result;
+}
+
+template<typename StringT>
+StringT CTimePeriod::FormatSqlInterval(StringT Result) const {
+    Result += "interval ";
+    AppendNumber(Result, m_TotalDuration.count());
+    Result += " second";
+    return Result;
+}
+
+inline std::string CTimePeriod::asSqlInterval() const {
+    return FormatSqlInterval(std::string());
+}
+
+template<typename ResourceT>
+auto CTimePeriod::asSqlInterval(ResourceT *Resource) const {
+    static_assert(std::is_base_of_v<std::pmr::memory_resource, ResourceT>, "Resource must be a std::pmr::memory_resource");
+    return FormatSqlInterval(std::pmr::string(Resource));
+}
+
+inline std::string CTimePeriod::toString() const {
+    return FormatString(std::string());
+}
+
+template<typename ResourceT>
+auto CTimePeriod::toString(ResourceT *Resource) const {
+    static_assert(std::is_base_of_v<std::pmr::memory_resource, ResourceT>, "Resource must be a std::pmr::memory_resource");
+    return FormatString(std::pmr::string(Resource));
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_FORMAT_HPP
@@ -0,0 +1,208 @@
+#ifndef TIMEDURATION_GRAMMAR_HPP
+#define TIMEDURATION_GRAMMAR_HPP
+
+#include <timeduration/ascii.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace timeduration {
+
+/**
+ * @brief Unit literal of a compact grammar, multiplier is in ticks of the grammar's Duration
+ */
+struct SGrammarUnit {
+    std::string_view m_Literal;
+    int64_t m_Multiplier;
+};
+
+/**
+ * @brief The library's own grammar ("2h 30m", bare numbers are minutes), parsed by CTimePeriod::TryParse
+ */
+struct CNativeGrammar {
+    using Duration = std::chrono::seconds;
+};
+
+/**
+ * @brief Go time.ParseDuration grammar ("1h30m", "1.5h", "-250ms")
+ *
+ * Every number needs a unit except a lone "0", a sign is only allowed in front, and
+ * units may repeat in any order. Unlike Go, fractions are computed exactly instead of
+ * through float64, so e.g. "0.3333333333333333333h" truncates to 19m59.999999999s.
+ */
+struct CGoGrammar {
+    using Duration = std::chrono::nanoseconds;
+
+    static constexpr bool ALLOW_SIGN = true;
+    static constexpr bool ALLOW_FRACTION = true;
+    static constexpr bool STRICT_ORDER = false;
+
+    static constexpr std::array<SGrammarUnit, 8> UNITS{{
+        {"ns", 1L},
+        {"us", 1000L},
+        {"\xC2\xB5s", 1000L}, // U+00B5 micro sign
+        {"\xCE\xBCs", 1000L}, // U+03BC greek small letter mu
+        {"ms", 1000000L},
+        {"s", 1000000000L},
+        {"m", 60000000000L},
+        {"h", 3600000000000L},
+    }};
+};
+
+/**
+ * @brief Prometheus range grammar ("1h30m", "5m", "2w")
+ *
+ * Integers only, no sign, units from largest to smallest with each used at most once.
+ * Years are 365 days and weeks are 7 days.
+ */
+struct CPrometheusGrammar {
+    using Duration = std::chrono::milliseconds;
+
+    static constexpr bool ALLOW_SIGN = false;
+    static constexpr bool ALLOW_FRACTION = false;
+    static constexpr bool STRICT_ORDER = true;
+
+    static constexpr std::array<SGrammarUnit, 7> UNITS{{
+        {"y", 31536000000L},
+        {"w", 604800000L},
+        {"d", 86400000L},
+        {"h", 3600000L},
+        {"m", 60000L},
+        {"s", 1000L},
+        {"ms", 1L},
+    }};
+};
+
+namespace detail {
+    /**
+     * @brief floor(Multiplier * 0.Digits) computed exactly, right to left
+     *
+     * Each step keeps the value below 10 * Multiplier, so no precision is lost and
+     * nothing overflows for any unit that fits in int64 / 10.
+     */
+    [[nodiscard]] constexpr uint64_t ScaleFraction(const std::string_view Digits, const uint64_t Multiplier) noexcept {
+        uint64_t Carry = 0;
+        for (size_t i = Digits.size(); i-- > 0;)
+            Carry = (static_cast<uint64_t>(Digits[i] - '0') * Multiplier + Carry) / 10;
+        return Carry;
+    }
+
+    template<typename GrammarT>
+    [[nodiscard]] constexpr bool ParseCompact(const std::string_view Source, typename GrammarT::Duration &Out) noexcept {
+        size_t Current = 0;
+        bool Negative = false;
+        if constexpr (GrammarT::ALLOW_SIGN) {
+            if (Current < Source.size() && (Source[Current] == '-' || Source[Current] == '+'))
+                Negative = Source[Current++] == '-';
+        }
+
+        if (Source.substr(Current) == "0") {
+            Out = typename GrammarT::Duration(0);
+            return true;
+        }
+        if (Current >= Source.size())
+            return false;
+
+        // Magnitude limit, one more tick is allowed for the most negative value
+        const uint64_t Limit = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (Negative ? 1 : 0);
+        uint64_t Total = 0;
+        size_t NextUnit = 0;
+
+        while (Current < Source.size()) {
+            const size_t IntegerStart = Current;
+            uint64_t Value = 0;
+            bool Overflow = false;
+            for (; Current < Source.size() && IsDigitAscii(Source[Current]); ++Current) {
+                const auto Digit = static_cast<uint64_t>(Source[Current] - '0');
+                if (Value > (Limit - Digit) / 10)
+                    Overflow = true;
+                else
+                    Value = Value * 10 + Digit;
+            }
+            bool HasDigits = Current > IntegerStart;
+
+            std::string_view Fraction;
+            if constexpr (GrammarT::ALLOW_FRACTION) {
+                if (Current < Source.size() && Source[Current] == '.') {
+                    const size_t FractionStart = ++Current;
+                    while (Current < Source.size() && IsDigitAscii(Source[Current]))
+                        ++Current;
+                    Fraction = Source.substr(FractionStart, Current - FractionStart);
+                    HasDigits = HasDigits || !Fraction.empty();
+                }
+            }
+            if (!HasDigits || Overflow)
+                return false;
+
+            // The unit runs until the next number
+            const size_t UnitStart = Current;
+            while (Current < Source.size() && Source[Current] != '.' && !IsDigitAscii(Source[Current]))
+                ++Current;
+            const std::string_view Literal = Source.substr(UnitStart, Current - UnitStart);
+
+            size_t Unit = GrammarT::STRICT_ORDER ? NextUnit : 0;
+            while (Unit < GrammarT::UNITS.size() && GrammarT::UNITS[Unit].m_Literal != Literal)
+                ++Unit;
+            if (Unit == GrammarT::UNITS.size())
+                return false;
+            NextUnit = Unit + 1;
+
+            const auto Multiplier = static_cast<uint64_t>(GrammarT::UNITS[Unit].m_Multiplier);
+            if (Value > Limit / Multiplier)
+                return false;
+            const uint64_t Component = Value * Multiplier + ScaleFraction(Fraction, Multiplier);
+            if (Component > Limit || Total > Limit - Component)
+                return false;
+            Total += Component;
+        }
+
+        Out = typename GrammarT::Duration(Negative ? static_cast<int64_t>(0 - Total) : static_cast<int64_t>(Total));
+        return true;
+    }
+} // namespace detail
+
+/**
+ * @brief Parse a duration with a grammar chosen at compile time
+ *
+ * CNativeGrammar (the default) forwards to CTimePeriod::TryParse unchanged; compact
+ * grammars share one allocation-free, non-throwing implementation.
+ *
+ * @param Source Duration string
+ * @param Out Receives the parsed duration in the grammar's resolution on success
+ * @return false on malformed input or overflow
+ */
+template<typename GrammarT = CNativeGrammar>
+[[nodiscard]] bool ParseWithGrammar(const std::string_view Source, typename GrammarT::Duration &Out) noexcept {
+    if constexpr (std::is_same_v<GrammarT, CNativeGrammar>)
+        return CTimePeriod::TryParse(Source, Out);
+    else
+        return detail::ParseCompact<GrammarT>(Source, Out);
+}
+
+/**
+ * @brief Parse a duration with a grammar chosen at compile time into a CTimePeriod
+ *
+ * Sub-second parts are truncated toward zero.
+ *
+ * @param Source Duration string
+ * @param Out Receives the parsed period on success
+ * @return false on malformed input or overflow
+ */
+template<typename GrammarT = CNativeGrammar>
+[[nodiscard]] bool ParseWithGrammar(const std::string_view Source, CTimePeriod &Out) noexcept {
+    typename GrammarT::Duration Value{0};
+    if (!ParseWithGrammar<GrammarT>(Source, Value))
+        return false;
+    Out = CTimePeriod(std::chrono::duration_cast<std::chrono::seconds>(Value));
+    return true;
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_GRAMMAR_HPP
@@ -0,0 +1,243 @@
+#ifndef TIMEDURATION_INDEX_HPP
+#define TIMEDURATION_INDEX_HPP
+
+#include <timeduration/core.hpp>
+#include <timeduration/sort.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace timeduration {
+
+namespace detail {
+    // Keys per leaf block: 128 bytes, two cache lines scanned without branches
+    inline constexpr size_t INDEX_BLOCK_SIZE = 16;
+
+    // Inserts are buffered until the buffer reaches max(MIN, sqrt(size) * FACTOR), then merged
+    inline constexpr size_t INDEX_MIN_BUFFER = 256;
+    inline constexpr size_t INDEX_BUFFER_FACTOR = 4;
+} // namespace detail
+
+/**
+ * @brief Ordered multi-index from durations (or deadlines) in seconds to values
+ *
+ * Keys live in one sorted array cut into blocks of 16; the first key of every block is kept
+ * again in Eytzinger (BFS) order, so a search walks a small, cache-resident implicit tree
+ * without branches and then counts within a single block. Inserts go to a small sorted
+ * buffer that is merged into the array once it grows past ~4 sqrt(size), which keeps an
+ * insert at O(sqrt(n)) amortized while queries stay on flat arrays.
+ *
+ * Entries with equal keys are kept in insertion order. Not thread-safe for writers.
+ */
+template<typename ValueT>
+class CDurationIndex final {
+public:
+    using Entry = std::pair<std::chrono::seconds, ValueT>;
+
+private:
+    // Sorted main run
+    std::vector<int64_t> m_vKeys;
+    std::vector<ValueT> m_vValues;
+    // First key of each block in Eytzinger order (1-based, slot 0 unused) and its block number
+    std::vector<int64_t> m_vSeparators;
+    std::vector<uint32_t> m_vSeparatorBlock;
+
+    // Sorted insert buffer
+    std::vector<int64_t> m_vBufferKeys;
+    std::vector<ValueT> m_vBufferValues;
+
+    void BuildSeparators() {
+        const size_t NumBlocks = (m_vKeys.size() + detail::INDEX_BLOCK_SIZE - 1) / detail::INDEX_BLOCK_SIZE;
+        m_vSeparators.assign(NumBlocks + 1, 0);
+        m_vSeparatorBlock.assign(NumBlocks + 1, 0);
+
+        // An in-order walk of the implicit tree visits the blocks in sorted order
+        size_t Block = 0;
+        const auto Fill = [&](const auto &Self, const size_t Node) -> void {
+            if (Node > NumBlocks)
+                return;
+            Self(Self, 2 * Node);
+            m_vSeparators[Node] = m_vKeys[Block * detail::INDEX_BLOCK_SIZE];
+            m_vSeparatorBlock[Node] = static_cast<uint32_t>(Block++);
+            Self(Self, 2 * Node + 1);
+        };
+        Fill(Fill, 1);
+    }
+
+    // Number of main-run keys below Key
+    [[nodiscard]] size_t MainLowerBound(const int64_t Key) const noexcept {
+        if (m_vSeparators.size() <= 1)
+            return 0;
+        const size_t NumBlocks = m_vSeparators.size() - 1;
+
+        size_t Node = 1;
+        while (Node <= NumBlocks)
+            Node = 2 * Node + (m_vSeparators[Node] < Key);
+        // Undo the right turns taken after the last left turn, and that left turn
+        Node >>= std::countr_one(Node) + 1;
+
+        // First block starting at or after Key; the block before it holds the boundary
+        const size_t FirstBlock = Node == 0 ? NumBlocks : m_vSeparatorBlock[Node];
+        if (FirstBlock == 0)
+            return 0;
+        const size_t Begin = (FirstBlock - 1) * detail::INDEX_BLOCK_SIZE;
+        const size_t End = std::min(Begin + detail::INDEX_BLOCK_SIZE, m_vKeys.size());
+        size_t Below = 0;
+        for (size_t i = Begin; i < End; ++i)
+            Below += m_vKeys[i] < Key;
+        return Begin + Below;
+    }
+
+    [[nodiscard]] size_t BufferLowerBound(const int64_t Key) const noexcept {
+        return static_cast<size_t>(std::lower_bound(m_vBufferKeys.begin(), m_vBufferKeys.end(), Key) -
+                                   m_vBufferKeys.begin());
+    }
+
+    [[nodiscard]] size_t BufferLimit() const noexcept {
+        const auto Root = static_cast<size_t>(std::sqrt(static_cast<double>(m_vKeys.size())));
+        return std::max(detail::INDEX_MIN_BUFFER, Root * detail::INDEX_BUFFER_FACTOR);
+    }
+
+public:
+    CDurationIndex() = default;
+
+    /**
+     * @brief Build from unsorted entries with a radix sort
+     */
+    explicit CDurationIndex(std::vector<Entry> Entries) {
+        BulkLoad(std::move(Entries));
+    }
+
+    /**
+     * @brief Replace the contents with unsorted entries, sorted with the LSD radix sort of sort.hpp
+     *
+     * @param Entries Key/value pairs, equal keys keep their relative order
+     */
+    void BulkLoad(std::vector<Entry> Entries) {
+        const size_t Size = Entries.size();
+        std::vector<uint64_t> vRadixKeys(Size);
+        std::vector<size_t> vOrder(Size);
+        for (size_t i = 0; i < Size; ++i) {
+            vRadixKeys[i] = detail::ToRadixKey(Entries[i].first.count());
+            vOrder[i] = i;
+        }
+        // Same stable radix sort as SortDurations, the keys come out sorted and ready to use
+        detail::RadixSortKeys(vRadixKeys.data(), vOrder.data(), Size);
+
+        m_vKeys.resize(Size);
+        m_vValues.clear();
+        m_vValues.reserve(Size);
+        for (size_t i = 0; i < Size; ++i) {
+            m_vKeys[i] = detail::FromRadixKey(vRadixKeys[i]);
+            m_vValues.push_back(std::move(Entries[vOrder[i]].second));
+        }
+        m_vBufferKeys.clear();
+        m_vBufferValues.clear();
+        BuildSeparators();
+    }
+
+    /**
+     * @brief Add one entry, after any existing entries with the same key
+     */
+    void Insert(const std::chrono::seconds Key, ValueT Value) {
+        const auto Position = std::upper_bound(m_vBufferKeys.begin(), m_vBufferKeys.end(), Key.count()) -
+                              m_vBufferKeys.begin();
+        m_vBufferKeys.insert(m_vBufferKeys.begin() + Position, Key.count());
+        m_vBufferValues.insert(m_vBufferValues.begin() + Position, std::move(Value));
+        if (m_vBufferKeys.size() > BufferLimit())
+            Compact();
+    }
+
+    void Insert(const CTimePeriod &Key, ValueT Value) {
+        Insert(Key.duration(), std::move(Value));
+    }
+
+    /**
+     * @brief Merge the insert buffer into the main run now instead of when it fills up
+     */
+    void Compact() {
+        if (m_vBufferKeys.empty())
+            return;
+
+        std::vector<int64_t> vKeys(m_vKeys.size() + m_vBufferKeys.size());
+        std::vector<ValueT> vValues;
+        vValues.reserve(vKeys.size());
+        size_t Main = 0;
+        size_t Buffer = 0;
+        for (auto &Key: vKeys) {
+            // Main wins ties, it holds the older entries
+            if (Buffer == m_vBufferKeys.size() || (Main < m_vKeys.size() && m_vKeys[Main] <= m_vBufferKeys[Buffer])) {
+                Key = m_vKeys[Main];
+                vValues.push_back(std::move(m_vValues[Main++]));
+            } else {
+                Key = m_vBufferKeys[Buffer];
+                vValues.push_back(std::move(m_vBufferValues[Buffer++]));
+            }
+        }
+        m_vKeys = std::move(vKeys);
+        m_vValues = std::move(vValues);
+        m_vBufferKeys.clear();
+        m_vBufferValues.clear();
+        BuildSeparators();
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return m_vKeys.size() + m_vBufferKeys.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Number of entries with From <= key < To, in O(log n)
+     */
+    [[nodiscard]] size_t CountInRange(const std::chrono::seconds From, const std::chrono::seconds To) const noexcept {
+        if (!(From < To))
+            return 0;
+        return MainLowerBound(To.count()) - MainLowerBound(From.count()) + BufferLowerBound(To.count()) -
+               BufferLowerBound(From.count());
+    }
+
+    [[nodiscard]] size_t CountInRange(const CTimePeriod &From, const CTimePeriod &To) const noexcept {
+        return CountInRange(From.duration(), To.duration());
+    }
+
+    /**
+     * @brief Call Fn(std::chrono::seconds Key, const ValueT &Value) for every entry with From <= key < To, in key order
+     */
+    template<typename FnT>
+    void ForEachInRange(const std::chrono::seconds From, const std::chrono::seconds To, FnT &&Fn) const {
+        if (!(From < To))
+            return;
+        size_t Main = MainLowerBound(From.count());
+        const size_t MainEnd = MainLowerBound(To.count());
+        size_t Buffer = BufferLowerBound(From.count());
+        const size_t BufferEnd = BufferLowerBound(To.count());
+
+        while (Main < MainEnd || Buffer < BufferEnd) {
+            if (Buffer == BufferEnd || (Main < MainEnd && m_vKeys[Main] <= m_vBufferKeys[Buffer])) {
+                Fn(std::chrono::seconds(m_vKeys[Main]), m_vValues[Main]);
+                ++Main;
+            } else {
+                Fn(std::chrono::seconds(m_vBufferKeys[Buffer]), m_vBufferValues[Buffer]);
+                ++Buffer;
+            }
+        }
+    }
+
+    template<typename FnT>
+    void ForEachInRange(const CTimePeriod &From, const CTimePeriod &To, FnT &&Fn) const {
+        ForEachInRange(From.duration(), To.duration(), std::forward<FnT>(Fn));
+    }
+};
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_INDEX_HPP
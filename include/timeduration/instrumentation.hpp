@@ -0,0 +1,279 @@
+#ifndef TIMEDURATION_INSTRUMENTATION_HPP
+#define TIMEDURATION_INSTRUMENTATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(TIMEDURATION_ENABLE_INSTRUMENTATION)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <mutex>
+#include <vector>
+#endif
+
+/**
+ * Opt-in parser instrumentation.
+ *
+ * Define TIMEDURATION_ENABLE_INSTRUMENTATION (or configure with the CMake option of the same
+ * name) to count parses, tokens, unknown units, overflows and scanned bytes, and to time a
+ * sample of parses. Without it every hook below is an empty inline function and compiles away.
+ * The setting must be the same in every translation unit of a program.
+ */
+namespace timeduration::instrumentation {
+
+/**
+ * @brief Totals across all threads, including threads that have already exited
+ */
+struct SSnapshot {
+    uint64_t m_Parses = 0;
+    uint64_t m_Tokens = 0;
+    uint64_t m_UnknownUnits = 0;
+    uint64_t m_Overflows = 0;
+    uint64_t m_BytesScanned = 0;
+    uint64_t m_SampledParses = 0;
+    uint64_t m_SampledNanoseconds = 0;
+    uint64_t m_MaxSampledNanoseconds = 0;
+};
+
+// Returns a monotonic timestamp in nanoseconds
+using ClockFn = uint64_t (*)() noexcept;
+
+#if defined(TIMEDURATION_ENABLE_INSTRUMENTATION)
+
+inline constexpr bool ENABLED = true;
+
+namespace detail {
+    enum {
+        COUNTER_PARSES = 0,
+        COUNTER_TOKENS,
+        COUNTER_UNKNOWN_UNITS,
+        COUNTER_OVERFLOWS,
+        COUNTER_BYTES_SCANNED,
+        COUNTER_SAMPLED_PARSES,
+        COUNTER_SAMPLED_NANOSECONDS,
+        NUM_COUNTERS
+    };
+
+    inline constexpr uint32_t DEFAULT_SAMPLE_INTERVAL = 64;
+
+    inline uint64_t SteadyClock() noexcept {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Written only by the owning thread, read relaxed by Snapshot()
+    struct alignas(64) SThreadCounters {
+        std::atomic<uint64_t> m_aValues[NUM_COUNTERS]{};
+        std::atomic<uint64_t> m_MaxSampled{0};
+        uint32_t m_UntilSample = 0;
+        uint32_t m_Muted = 0; // open CMuteScope count, nothing is counted while nonzero
+
+        void Add(const int Counter, const uint64_t Amount) noexcept {
+            if (m_Muted)
+                return;
+            auto &Value = m_aValues[Counter];
+            Value.store(Value.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+        }
+    };
+
+    struct SRegistry {
+        std::mutex m_Mutex;
+        std::vector<SThreadCounters *> m_vpLive;
+        uint64_t m_aRetired[NUM_COUNTERS]{};
+        uint64_t m_RetiredMax = 0;
+        std::atomic<ClockFn> m_Clock{&SteadyClock};
+        std::atomic<uint32_t> m_SampleInterval{DEFAULT_SAMPLE_INTERVAL};
+    };
+
+    inline SRegistry &Registry() {
+        static SRegistry s_Registry;
+        return s_Registry;
+    }
+
+    // Registers the thread's counters on first use and folds them into the retired totals on exit
+    struct SThreadHandle {
+        SThreadCounters m_Counters;
+        bool m_Registered = false;
+
+        SThreadHandle() noexcept {
+            auto &Reg = Registry();
+            const std::lock_guard Lock(Reg.m_Mutex);
+            try {
+                Reg.m_vpLive.push_back(&m_Counters);
+                m_Registered = true;
+            } catch (...) {
+                // Counting is best effort, an unregistered thread just goes unreported
+            }
+        }
+
+        ~SThreadHandle() {
+            if (!m_Registered)
+                return;
+            auto &Reg = Registry();
+            const std::lock_guard Lock(Reg.m_Mutex);
+            for (int i = 0; i < NUM_COUNTERS; ++i)
+                Reg.m_aRetired[i] += m_Counters.m_aValues[i].load(std::memory_order_relaxed);
+            Reg.m_RetiredMax = std::max(Reg.m_RetiredMax, m_Counters.m_MaxSampled.load(std::memory_order_relaxed));
+            Reg.m_vpLive.erase(std::find(Reg.m_vpLive.begin(), Reg.m_vpLive.end(), &m_Counters));
+        }
+    };
+
+    inline SThreadCounters &Local() noexcept {
+        thread_local SThreadHandle s_Handle;
+        return s_Handle.m_Counters;
+    }
+} // namespace detail
+
+inline void CountTokens(const uint64_t Amount) noexcept {
+    detail::Local().Add(detail::COUNTER_TOKENS, Amount);
+}
+
+inline void CountUnknownUnit() noexcept {
+    detail::Local().Add(detail::COUNTER_UNKNOWN_UNITS, 1);
+}
+
+inline void CountOverflow() noexcept {
+    detail::Local().Add(detail::COUNTER_OVERFLOWS, 1);
+}
+
+/**
+ * @brief Counts one parse and its input size, and times it if this parse is due for sampling
+ */
+class CParseScope final {
+    detail::SThreadCounters &m_Counters;
+    ClockFn m_Clock = nullptr;
+    uint64_t m_Start = 0;
+
+public:
+    explicit CParseScope(const size_t Bytes) noexcept : m_Counters(detail::Local()) {
+        if (m_Counters.m_Muted)
+            return;
+        m_Counters.Add(detail::COUNTER_PARSES, 1);
+        m_Counters.Add(detail::COUNTER_BYTES_SCANNED, Bytes);
+
+        if (m_Counters.m_UntilSample > 0) {
+            --m_Counters.m_UntilSample;
+            return;
+        }
+        const auto &Reg = detail::Registry();
+        const uint32_t Interval = Reg.m_SampleInterval.load(std::memory_order_relaxed);
+        if (Interval == 0)
+            return;
+        m_Counters.m_UntilSample = Interval - 1;
+        m_Clock = Reg.m_Clock.load(std::memory_order_relaxed);
+        m_Start = m_Clock();
+    }
+
+    ~CParseScope() {
+        if (!m_Clock)
+            return;
+        const uint64_t Elapsed = m_Clock() - m_Start;
+        m_Counters.Add(detail::COUNTER_SAMPLED_PARSES, 1);
+        m_Counters.Add(detail::COUNTER_SAMPLED_NANOSECONDS, Elapsed);
+        if (Elapsed > m_Counters.m_MaxSampled.load(std::memory_order_relaxed))
+            m_Counters.m_MaxSampled.store(Elapsed, std::memory_order_relaxed);
+    }
+
+    CParseScope(const CParseScope &) = delete;
+    CParseScope &operator=(const CParseScope &) = delete;
+};
+
+/**
+ * @brief Stops counting on this thread while alive, for work that repeats a parse already counted
+ */
+class CMuteScope final {
+    detail::SThreadCounters &m_Counters;
+
+public:
+    CMuteScope() noexcept : m_Counters(detail::Local()) {
+        ++m_Counters.m_Muted;
+    }
+
+    ~CMuteScope() {
+        --m_Counters.m_Muted;
+    }
+
+    CMuteScope(const CMuteScope &) = delete;
+    CMuteScope &operator=(const CMuteScope &) = delete;
+};
+
+/**
+ * @brief Replace the clock used for latency samples (default: steady_clock)
+ *
+ * @param Clock Function returning a monotonic timestamp in nanoseconds, nullptr restores the default
+ */
+inline void SetClock(const ClockFn Clock) noexcept {
+    detail::Registry().m_Clock.store(Clock ? Clock : &detail::SteadyClock, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Time one parse out of every Interval per thread, 0 disables latency sampling
+ *
+ * @param Interval Sampling interval
+ */
+inline void SetSampleInterval(const uint32_t Interval) noexcept {
+    detail::Registry().m_SampleInterval.store(Interval, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Collect the counters of all threads
+ *
+ * @return SSnapshot Totals since program start
+ */
+[[nodiscard]] inline SSnapshot Snapshot() {
+    auto &Reg = detail::Registry();
+    const std::lock_guard Lock(Reg.m_Mutex);
+
+    uint64_t aTotals[detail::NUM_COUNTERS];
+    std::copy(std::begin(Reg.m_aRetired), std::end(Reg.m_aRetired), aTotals);
+    uint64_t Max = Reg.m_RetiredMax;
+    for (const auto *pCounters: Reg.m_vpLive) {
+        for (int i = 0; i < detail::NUM_COUNTERS; ++i)
+            aTotals[i] += pCounters->m_aValues[i].load(std::memory_order_relaxed);
+        Max = std::max(Max, pCounters->m_MaxSampled.load(std::memory_order_relaxed));
+    }
+
+    SSnapshot Result;
+    Result.m_Parses = aTotals[detail::COUNTER_PARSES];
+    Result.m_Tokens = aTotals[detail::COUNTER_TOKENS];
+    Result.m_UnknownUnits = aTotals[detail::COUNTER_UNKNOWN_UNITS];
+    Result.m_Overflows = aTotals[detail::COUNTER_OVERFLOWS];
+    Result.m_BytesScanned = aTotals[detail::COUNTER_BYTES_SCANNED];
+    Result.m_SampledParses = aTotals[detail::COUNTER_SAMPLED_PARSES];
+    Result.m_SampledNanoseconds = aTotals[detail::COUNTER_SAMPLED_NANOSECONDS];
+    Result.m_MaxSampledNanoseconds = Max;
+    return Result;
+}
+
+#else
+
+inline constexpr bool ENABLED = false;
+
+inline void CountTokens(uint64_t) noexcept {}
+inline void CountUnknownUnit() noexcept {}
+inline void CountOverflow() noexcept {}
+
+class CParseScope final {
+public:
+    explicit constexpr CParseScope(size_t) noexcept {}
+};
+
+class CMuteScope final {
+public:
+    constexpr CMuteScope() noexcept {}
+};
+
+inline void SetClock(ClockFn) noexcept {}
+inline void SetSampleInterval(uint32_t) noexcept {}
+
+[[nodiscard]] inline SSnapshot Snapshot() {
+    return {};
+}
+
+#endif
+
+} // namespace timeduration::instrumentation
+
+#endif // TIMEDURATION_INSTRUMENTATION_HPP
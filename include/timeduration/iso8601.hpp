@@ -0,0 +1,238 @@
+#ifndef TIMEDURATION_ISO8601_HPP
+#define TIMEDURATION_ISO8601_HPP
+
+#include <timeduration/ascii.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace timeduration {
+
+// Longest output of FormatIso8601 is 28 bytes: "-P" + 15 day digits + "DT23H59M59S"
+inline constexpr size_t ISO8601_MAX_LENGTH = 32;
+
+namespace detail {
+    // Writes the decimal form of Value backwards ending at End, returns the new start
+    [[nodiscard]] inline char *WriteDigitsBackward(char *End, uint64_t Value) noexcept {
+        do {
+            *--End = static_cast<char>('0' + Value % 10);
+            Value /= 10;
+        } while (Value != 0);
+        return End;
+    }
+} // namespace detail
+
+/**
+ * @brief Check whether a string uses the ISO 8601 duration grammar
+ *
+ * @param Source Input string
+ * @return true if it starts with 'P', optionally preceded by a sign
+ */
+[[nodiscard]] constexpr bool IsIso8601Duration(const std::string_view Source) noexcept {
+    size_t Offset = 0;
+    if (!Source.empty() && (Source[0] == '-' || Source[0] == '+'))
+        Offset = 1;
+    return Offset < Source.size() && detail::ToUpperAscii(Source[Offset]) == 'P';
+}
+
+/**
+ * @brief Parse an ISO 8601 duration (e.g. "P1DT2H30M", "PT15.5S") without allocating or throwing
+ *
+ * Units follow the library convention: Y is 365 days, M (before T) is 28 days, W is 7 days.
+ * Only the last component may carry a fraction ('.' or ','); the result is truncated to
+ * whole seconds. A leading '-' negates the duration.
+ *
+ * @param Source ISO 8601 duration string
+ * @param Out Receives the parsed duration on success
+ * @return false on malformed input or overflow
+ */
+[[nodiscard]] inline bool ParseIso8601(const std::string_view Source, std::chrono::seconds &Out) noexcept {
+    constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+
+    size_t Current = 0;
+    bool Negative = false;
+    if (Current < Source.size() && (Source[Current] == '-' || Source[Current] == '+'))
+        Negative = Source[Current++] == '-';
+    if (Current >= Source.size() || detail::ToUpperAscii(Source[Current]) != 'P')
+        return false;
+    ++Current;
+
+    // Designators in the order they must appear, date part then time part
+    constexpr char s_Designators[] = {'Y', 'M', 'W', 'D', 'H', 'M', 'S'};
+    constexpr int64_t s_Multipliers[] = {31536000L, 2419200L, 604800L, 86400L, 3600L, 60L, 1L};
+    constexpr size_t TIME_PART = 4;
+
+    size_t Next = 0; // index of the earliest designator still allowed
+    bool InTime = false;
+    bool Fractional = false;
+    bool Any = false;
+    int64_t Total = 0;
+
+    while (Current < Source.size()) {
+        if (detail::ToUpperAscii(Source[Current]) == 'T') {
+            // 'T' must be followed by at least one time component
+            if (InTime || Current + 1 >= Source.size())
+                return false;
+            InTime = true;
+            Next = TIME_PART;
+            ++Current;
+            continue;
+        }
+
+        // A fractional component has to be the last one
+        if (Fractional || !detail::IsDigitAscii(Source[Current]))
+            return false;
+
+        int64_t Value = 0;
+        for (; Current < Source.size() && detail::IsDigitAscii(Source[Current]); ++Current) {
+            const int Digit = Source[Current] - '0';
+            if (Value > (Max - Digit) / 10)
+                return false;
+            Value = Value * 10 + Digit;
+        }
+
+        int64_t Fraction = 0;
+        int64_t Scale = 1;
+        if (Current < Source.size() && (Source[Current] == '.' || Source[Current] == ',')) {
+            ++Current;
+            if (Current >= Source.size() || !detail::IsDigitAscii(Source[Current]))
+                return false;
+            // Nine digits are enough for second resolution of any unit, the rest is dropped
+            for (; Current < Source.size() && detail::IsDigitAscii(Source[Current]); ++Current) {
+                if (Scale < 1000000000L) {
+                    Fraction = Fraction * 10 + (Source[Current] - '0');
+                    Scale *= 10;
+                }
+            }
+            Fractional = true;
+        }
+
+        if (Current >= Source.size())
+            return false;
+        const char Designator = detail::ToUpperAscii(Source[Current++]);
+
+        size_t Slot = Next;
+        const size_t End = InTime ? std::size(s_Designators) : TIME_PART;
+        while (Slot < End && s_Designators[Slot] != Designator)
+            ++Slot;
+        if (Slot == End)
+            return false;
+        Next = Slot + 1;
+
+        const int64_t Multiplier = s_Multipliers[Slot];
+        if (Value > Max / Multiplier)
+            return false;
+        const int64_t Whole = Value * Multiplier;
+        // Fraction < Scale <= 1e9 and Multiplier <= 31536000, so the product stays in range
+        const int64_t Part = Fraction * Multiplier / Scale;
+        if (Whole > Max - Part || Total > Max - Whole - Part)
+            return false;
+        Total += Whole + Part;
+        Any = true;
+    }
+
+    if (!Any)
+        return false;
+
+    Out = std::chrono::seconds(Negative ? -Total : Total);
+    return true;
+}
+
+/**
+ * @brief Write a duration as ISO 8601 (e.g. "P1DT2H30M15S") into a caller buffer
+ *
+ * Days are the largest unit emitted so the output round-trips exactly; zero is "PT0S".
+ *
+ * @param Duration Duration to format
+ * @param Buffer Destination, ISO8601_MAX_LENGTH bytes always suffice
+ * @return size_t Number of characters written, 0 if the buffer is too small
+ */
+[[nodiscard]] inline size_t FormatIso8601(const std::chrono::seconds Duration, const std::span<char> Buffer) noexcept {
+    const int64_t Count = Duration.count();
+    uint64_t Remaining = Count < 0 ? 0 - static_cast<uint64_t>(Count) : static_cast<uint64_t>(Count);
+
+    const uint64_t Days = Remaining / 86400;
+    Remaining %= 86400;
+    const uint64_t Hours = Remaining / 3600;
+    Remaining %= 3600;
+    const uint64_t Minutes = Remaining / 60;
+    const uint64_t Seconds = Remaining % 60;
+
+    char Scratch[ISO8601_MAX_LENGTH];
+    char *End = Scratch + sizeof(Scratch);
+    char *Start = End;
+
+    const auto Emit = [&](const uint64_t Value, const char Designator) {
+        *--Start = Designator;
+        Start = detail::WriteDigitsBackward(Start, Value);
+    };
+
+    if (Seconds != 0 || Count == 0)
+        Emit(Seconds, 'S');
+    if (Minutes != 0)
+        Emit(Minutes, 'M');
+    if (Hours != 0)
+        Emit(Hours, 'H');
+    if (Hours != 0 || Minutes != 0 || Seconds != 0 || Count == 0)
+        *--Start = 'T';
+    if (Days != 0)
+        Emit(Days, 'D');
+    *--Start = 'P';
+    if (Count < 0)
+        *--Start = '-';
+
+    const auto Length = static_cast<size_t>(End - Start);
+    if (Length > Buffer.size())
+        return 0;
+    std::copy(Start, End, Buffer.data());
+    return Length;
+}
+
+/**
+ * @brief Format a CTimePeriod as an ISO 8601 duration string
+ *
+ * @param Period Period to format
+ * @return std::string ISO 8601 representation (e.g. "PT2H30M15S")
+ */
+[[nodiscard]] inline std::string ToIso8601(const CTimePeriod &Period) {
+    char Buffer[ISO8601_MAX_LENGTH];
+    return {Buffer, FormatIso8601(Period.duration(), Buffer)};
+}
+
+/**
+ * @brief Format a CTimePeriod as an ISO 8601 duration string, allocating only from Resource
+ *
+ * @param Period Period to format
+ * @param Resource Memory resource for the returned string
+ * @return std::pmr::string ISO 8601 representation (e.g. "PT2H30M15S")
+ */
+[[nodiscard]] inline std::pmr::string ToIso8601(const CTimePeriod &Period, std::pmr::memory_resource *Resource) {
+    char Buffer[ISO8601_MAX_LENGTH];
+    return {Buffer, FormatIso8601(Period.duration(), Buffer), Resource};
+}
+
+/**
+ * @brief Parse either grammar, picking ISO 8601 when the input starts with 'P'
+ *
+ * @param Source Native ("2h 30m") or ISO 8601 ("PT2H30M") duration string
+ * @param Out Receives the parsed duration on success
+ * @return false on malformed ISO input or overflow
+ */
+[[nodiscard]] inline bool TryParseDuration(const std::string_view Source, std::chrono::seconds &Out) noexcept {
+    if (IsIso8601Duration(Source))
+        return ParseIso8601(Source, Out);
+    return CTimePeriod::TryParse(Source, Out);
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_ISO8601_HPP
@@ -0,0 +1,401 @@
+#ifndef TIMEDURATION_PARSE_HPP
+#define TIMEDURATION_PARSE_HPP
+
+#include <timeduration/ascii.hpp>
+#include <timeduration/core.hpp>
+#include <timeduration/instrumentation.hpp>
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace timeduration {
+
+namespace detail {
+    struct SNativeLiteral {
+        std::string_view m_Literal;
+        ENativeUnit m_Unit;
+    };
+
+    inline constexpr std::array<SNativeLiteral, 12> NATIVE_LITERALS{{
+        {"s", UNIT_SECONDS}, {"seconds", UNIT_SECONDS},
+        {"m", UNIT_MINUTES}, {"minutes", UNIT_MINUTES},
+        {"h", UNIT_HOURS}, {"hours", UNIT_HOURS},
+        {"d", UNIT_DAYS}, {"days", UNIT_DAYS},
+        {"mo", UNIT_MONTHS}, {"months", UNIT_MONTHS},
+        {"y", UNIT_YEARS}, {"years", UNIT_YEARS},
+    }};
+
+    // Overflow-checked arithmetic for the throwing parse path and compiled expressions
+    [[nodiscard]] constexpr bool CheckedAdd(const int64_t Lhs, const int64_t Rhs, int64_t &Out) noexcept {
+        constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+        constexpr int64_t Min = std::numeric_limits<int64_t>::min();
+        if ((Rhs > 0 && Lhs > Max - Rhs) || (Rhs < 0 && Lhs < Min - Rhs))
+            return false;
+        Out = Lhs + Rhs;
+        return true;
+    }
+
+    [[nodiscard]] constexpr bool CheckedMultiply(const int64_t Lhs, const int64_t Rhs, int64_t &Out) noexcept {
+        constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+        constexpr int64_t Min = std::numeric_limits<int64_t>::min();
+        if (Lhs == 0 || Rhs == 0) {
+            Out = 0;
+            return true;
+        }
+        if ((Lhs == -1 && Rhs == Min) || (Rhs == -1 && Lhs == Min))
+            return false;
+        if (Lhs > 0 ? (Rhs > 0 ? Lhs > Max / Rhs : Rhs < Min / Lhs) : (Rhs > 0 ? Lhs < Min / Rhs : Lhs < Max / Rhs))
+            return false;
+        Out = Lhs * Rhs;
+        return true;
+    }
+
+    /**
+     * @brief Allocation-free scan of the native grammar, shared by every non-throwing parse path
+     *
+     * Calls OnValue(ENativeUnit, int64_t) for each number with a known unit; bare numbers are
+     * minutes, numbers with an unknown unit are skipped. Declared inline on purpose: without
+     * the hint GCC keeps it out of line and TryParse loses its constant-folded unit lookup.
+     *
+     * @return false if a limit is exceeded, a number overflows int64_t or OnValue returns false
+     */
+    template<typename FnT>
+    [[nodiscard]] inline bool ScanNative(const std::string_view Source, const SParseLimits &Limits, FnT &&OnValue) noexcept {
+        constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+
+        if (Source.size() > Limits.m_MaxLength)
+            return false;
+
+        size_t Current = 0;
+        size_t TokensLeft = Limits.m_MaxTokens;
+        while (Current < Source.size()) {
+            if (!IsDigitAscii(Source[Current])) {
+                ++Current;
+                continue;
+            }
+            if (TokensLeft-- == 0)
+                return false;
+
+            int64_t Value = 0;
+            for (; Current < Source.size() && IsDigitAscii(Source[Current]); ++Current) {
+                const int Digit = Source[Current] - '0';
+                if (Value > (Max - Digit) / 10) {
+                    instrumentation::CountOverflow();
+                    return false;
+                }
+                Value = Value * 10 + Digit;
+            }
+            instrumentation::CountTokens(1);
+
+            const size_t Offset = Current;
+            while (Current < Source.size() && IsUnitChar(Source[Current]))
+                ++Current;
+            const std::string_view Literal(Source.data() + Offset, Current - Offset);
+
+            if (Literal.empty()) {
+                if (!OnValue(UNIT_MINUTES, Value))
+                    return false;
+                continue;
+            }
+
+            const SNativeLiteral *pUnit = nullptr;
+            for (const auto &Unit: NATIVE_LITERALS) {
+                if (Unit.m_Literal == Literal) {
+                    pUnit = &Unit;
+                    break;
+                }
+            }
+            if (!pUnit)
+                instrumentation::CountUnknownUnit();
+            else if (!OnValue(pUnit->m_Unit, Value))
+                return false;
+        }
+        return true;
+    }
+} // namespace detail
+
+/**
+ * @brief Container types used by a scanner whose storage comes from AllocatorT
+ */
+template<typename AllocatorT>
+struct SScannerTypes {
+    template<typename T>
+    using Rebind = typename std::allocator_traits<AllocatorT>::template rebind_alloc<T>;
+
+    using String = std::basic_string<char, std::char_traits<char>, AllocatorT>;
+    using TokenHolder = std::map<String, int64_t, std::less<String>, Rebind<std::pair<const String, int64_t>>>;
+    using ResultHolder = std::map<int64_t, int64_t, std::less<int64_t>, Rebind<std::pair<const int64_t, int64_t>>>;
+};
+
+using TokenHolder = std::map<std::string, int64_t>; // <literal, multiplier> (e.g. <"minutes", 60>)
+using ResultHolder = std::map<int64_t, int64_t>; // <multiplier, value> (e.g. <60, 15>)
+using PmrTokenHolder = std::pmr::map<std::pmr::string, int64_t>;
+using PmrResultHolder = std::pmr::map<int64_t, int64_t>;
+
+/**
+ * @brief Scanner class that handles the tokenization and parsing of time duration strings
+ *
+ * All storage (source copy, unit table, result) is obtained from AllocatorT.
+ */
+template<typename AllocatorT>
+class CBasicScanner final {
+public:
+    using String = typename SScannerTypes<AllocatorT>::String;
+    using Tokens = typename SScannerTypes<AllocatorT>::TokenHolder;
+    using Result = typename SScannerTypes<AllocatorT>::ResultHolder;
+
+private:
+    const String m_Source;
+    Tokens m_Tokens;
+    Result m_Result;
+    size_t m_TokensLeft;
+
+    size_t m_Start = 0;
+    size_t m_Current = 0;
+
+    [[nodiscard]] static std::string_view CheckLength(const std::string_view Source, const SParseLimits &Limits) {
+        if (Source.size() > Limits.m_MaxLength)
+            throw std::length_error("duration string exceeds the length limit");
+        return Source;
+    }
+
+    [[nodiscard]] bool AtEnd() const {
+        return m_Current >= m_Source.length();
+    }
+
+    char Advance() {
+        return m_Source[m_Current++];
+    }
+
+    [[nodiscard]] char Peek() const {
+        if (AtEnd()) return '\0';
+        return m_Source[m_Current];
+    }
+
+    [[nodiscard]] int64_t ToNumber(const std::string_view Digits) const {
+        // Same contract as std::stoll on a run of digits, without the temporary string
+        int64_t Value = 0;
+        if (std::from_chars(Digits.data(), Digits.data() + Digits.size(), Value).ec != std::errc()) {
+            instrumentation::CountOverflow();
+            throw std::out_of_range("stoll");
+        }
+        return Value;
+    }
+
+    void ScanToken() {
+        if (const char c = Advance(); detail::IsDigitAscii(c)) {
+            if (m_TokensLeft-- == 0)
+                throw std::length_error("duration string exceeds the token limit");
+
+            // More than 19 significant digits cannot fit int64_t, stop before scanning the rest of the run
+            size_t Significant = c != '0';
+            while (detail::IsDigitAscii(Peek())) {
+                Significant += Significant != 0 || Peek() != '0';
+                if (Significant > std::numeric_limits<int64_t>::digits10 + 1) {
+                    instrumentation::CountOverflow();
+                    throw std::out_of_range("stoll");
+                }
+                Advance();
+            }
+            const std::string_view Source(m_Source);
+            const int64_t Value = ToNumber(Source.substr(m_Start, m_Current - m_Start));
+            instrumentation::CountTokens(1);
+            const size_t Offset = m_Current;
+
+            while (detail::IsUnitChar(Peek())) Advance();
+            const std::string_view Literal = Source.substr(Offset, m_Current - Offset);
+
+            if (Literal.empty())
+                AddValue(60, Value);
+            else
+                AddValue(Literal, Value);
+        }
+    }
+
+    void AddValue(const std::string_view Literal, const int64_t Value) {
+        const String Key(Literal, m_Result.get_allocator());
+        if (const auto TokIt = m_Tokens.find(Key); TokIt != m_Tokens.end())
+            AddValue(TokIt->second, Value);
+        else
+            instrumentation::CountUnknownUnit();
+    }
+
+    void AddValue(int64_t Multiplier, int64_t Value) {
+        if (const auto ResIt = m_Result.find(Multiplier); ResIt != m_Result.end()) {
+            if (!detail::CheckedAdd(ResIt->second, Value, ResIt->second)) {
+                instrumentation::CountOverflow();
+                throw std::out_of_range("duration overflows int64_t seconds");
+            }
+        } else
+            m_Result.emplace(Multiplier, Value);
+    }
+
+public:
+    explicit CBasicScanner(const std::string_view Source, Tokens Multipliers,
+                           const AllocatorT &Allocator = AllocatorT()) : CBasicScanner(Source, std::move(Multipliers),
+                                                                                       SParseLimits(), Allocator) {
+    }
+
+    /**
+     * @throws std::length_error from the constructor if Source is longer than Limits allow
+     * (nothing is copied then) and from ScanTokens once the token limit is exceeded
+     */
+    CBasicScanner(const std::string_view Source, Tokens Multipliers, const SParseLimits &Limits,
+                  const AllocatorT &Allocator = AllocatorT()) : m_Source(CheckLength(Source, Limits), Allocator),
+        m_Tokens(std::move(Multipliers)), m_Result(Allocator), m_TokensLeft(Limits.m_MaxTokens) {
+    }
+
+    [[nodiscard]] Result ScanTokens() {
+        while (!AtEnd()) {
+            m_Start = m_Current;
+            ScanToken();
+        }
+        // Copy with our own allocator, a plain copy would fall back to the default resource
+        return Result(m_Result, m_Result.get_allocator());
+    }
+};
+
+using CScanner = CBasicScanner<std::allocator<char>>;
+using CPmrScanner = CBasicScanner<std::pmr::polymorphic_allocator<char>>;
+
+/**
+ * @brief Build the built-in unit table with storage from Allocator
+ *
+ * @param Allocator Allocator for the table's nodes and strings
+ * @return Unit table accepted by CBasicScanner<AllocatorT>
+ */
+template<typename AllocatorT = std::allocator<char>>
+[[nodiscard]] auto DefaultTokens(const AllocatorT &Allocator = AllocatorT()) -> typename SScannerTypes<AllocatorT>::TokenHolder {
+    using String = typename SScannerTypes<AllocatorT>::String;
+    typename SScannerTypes<AllocatorT>::TokenHolder Tokens(Allocator);
+    for (const auto &[Literal, Multiplier]: {
+             std::pair<std::string_view, int64_t>{"s", 1L}, {"seconds", 1L},
+             {"m", 60L}, {"minutes", 60L},
+             {"h", 3600L}, {"hours", 3600L},
+             {"d", 86400L}, {"days", 86400L},
+             {"mo", 2419200L}, {"months", 2419200L},
+             {"y", 31536000L}, {"years", 31536000L},
+         })
+        Tokens.emplace(String(Literal, Allocator), Multiplier);
+    return Tokens;
+}
+
+template<typename AllocatorT>
+std::chrono::seconds CTimePeriod::ParseWith(const std::string_view from, const AllocatorT &Allocator,
+                                            const SParseLimits &Limits) {
+    const instrumentation::CParseScope Scope(from.size());
+    CBasicScanner<AllocatorT> Scanner(from, DefaultTokens(Allocator), Limits, Allocator);
+
+    auto Result = Scanner.ScanTokens();
+    int64_t Total = 0;
+    for (auto [Multiplier, Value]: Result) {
+        int64_t Seconds = 0;
+        if (!detail::CheckedMultiply(Multiplier, Value, Seconds) || !detail::CheckedAdd(Total, Seconds, Total)) {
+            instrumentation::CountOverflow();
+            throw std::out_of_range("duration overflows int64_t seconds");
+        }
+    }
+
+    return std::chrono::seconds(Total);
+}
+
+inline CTimePeriod::CTimePeriod(const std::string_view from) {
+    // Allocation-free scan first, only input it rejects goes through Parse for the exceptions
+    if (SParsedComponents Components; TryParseComponents(from, Components)) {
+        *this = CTimePeriod(Components);
+        return;
+    }
+    // The scan above already counted this input
+    const instrumentation::CMuteScope Mute;
+    m_TotalDuration = Parse(from);
+    Validate();
+}
+
+inline std::chrono::seconds CTimePeriod::Parse(const std::string_view from) {
+    return ParseWith(from, std::allocator<char>());
+}
+
+template<typename ResourceT>
+std::chrono::seconds CTimePeriod::Parse(const std::string_view from, ResourceT *Resource) {
+    static_assert(std::is_base_of_v<std::pmr::memory_resource, ResourceT>, "Resource must be a std::pmr::memory_resource");
+    return ParseWith(from, std::pmr::polymorphic_allocator<char>(Resource));
+}
+
+inline std::chrono::seconds CTimePeriod::Parse(const std::string_view from, const SParseLimits &Limits) {
+    return ParseWith(from, std::allocator<char>(), Limits);
+}
+
+inline bool CTimePeriod::TryParse(const std::string_view from, std::chrono::seconds &Out) noexcept {
+    return TryParse(from, Out, SParseLimits());
+}
+
+inline bool CTimePeriod::TryParse(const std::string_view from, std::chrono::seconds &Out,
+                                  const SParseLimits &Limits) noexcept {
+    constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+
+    if (from.size() > Limits.m_MaxLength)
+        return false;
+
+    const instrumentation::CParseScope Scope(from.size());
+    int64_t Total = 0;
+    const bool Success = detail::ScanNative(from, Limits, [&Total](const ENativeUnit Unit, const int64_t Value) {
+        const int64_t Multiplier = NATIVE_UNIT_SECONDS[Unit];
+        if (Value > Max / Multiplier || Total > Max - Value * Multiplier) {
+            instrumentation::CountOverflow();
+            return false;
+        }
+        Total += Value * Multiplier;
+        return true;
+    });
+    if (!Success)
+        return false;
+
+    Out = std::chrono::seconds(Total);
+    return true;
+}
+
+inline bool CTimePeriod::TryParseComponents(const std::string_view from, SParsedComponents &Out,
+                                            const SParseLimits &Limits) noexcept {
+    constexpr int64_t Max = std::numeric_limits<int64_t>::max();
+
+    if (from.size() > Limits.m_MaxLength)
+        return false;
+
+    const instrumentation::CParseScope Scope(from.size());
+    SParsedComponents Components;
+    int64_t Total = 0;
+    const bool Success = detail::ScanNative(from, Limits, [&Components, &Total](const ENativeUnit Unit, const int64_t Value) {
+        // A slot never exceeds the total, so checking the total covers the slot as well
+        const int64_t Multiplier = NATIVE_UNIT_SECONDS[Unit];
+        if (Value > Max / Multiplier || Total > Max - Value * Multiplier) {
+            instrumentation::CountOverflow();
+            return false;
+        }
+        Total += Value * Multiplier;
+        Components[Unit] += Value;
+        return true;
+    });
+    if (!Success)
+        return false;
+
+    Out = Components;
+    return true;
+}
+
+inline CTimePeriod CTimePeriod::ParseFactory(const std::string_view from) {
+    return CTimePeriod(Parse(from));
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_PARSE_HPP
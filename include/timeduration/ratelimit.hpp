@@ -0,0 +1,232 @@
+#ifndef TIMEDURATION_RATELIMIT_HPP
+#define TIMEDURATION_RATELIMIT_HPP
+
+#include <timeduration/ascii.hpp>
+#include <timeduration/parse.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+namespace timeduration {
+
+/**
+ * @brief m_Count events per m_Period, e.g. "100 per 1m"
+ */
+struct SRateLimit {
+    uint64_t m_Count = 0;
+    CTimePeriod m_Period;
+};
+
+namespace detail {
+    [[nodiscard]] constexpr std::string_view TrimSpaces(std::string_view Text) noexcept {
+        while (!Text.empty() && IsSpaceAscii(Text.front()))
+            Text.remove_prefix(1);
+        while (!Text.empty() && IsSpaceAscii(Text.back()))
+            Text.remove_suffix(1);
+        return Text;
+    }
+
+    // A lone unit literal ("per h", "per minutes") means one of it
+    [[nodiscard]] constexpr bool ParseLoneUnit(const std::string_view Text, std::chrono::seconds &Out) noexcept {
+        for (const auto &Unit: NATIVE_LITERALS) {
+            if (Unit.m_Literal == Text) {
+                Out = std::chrono::seconds(NATIVE_UNIT_SECONDS[Unit.m_Unit]);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Longest period whose nanosecond count still fits int64_t
+    inline constexpr int64_t MAX_RATE_PERIOD_SECONDS = std::numeric_limits<int64_t>::max() / 1000000000;
+} // namespace detail
+
+/**
+ * @brief Parse a rate limit spec without allocating or throwing
+ *
+ * Grammar: "<count> per <duration>" or "<count>/<duration>", where the duration is in the
+ * native grammar ("100 per 1m", "5/30s", "1000 per 1h 30m") or a lone unit ("10 per s").
+ *
+ * @param from Spec to parse
+ * @param Out Receives the limit on success
+ * @param Limits Maximum input length and number count, applied to the whole spec
+ * @return false if the spec is malformed, the count is zero, or the period is zero or longer than ~292 years
+ */
+[[nodiscard]] inline bool TryParseRateLimit(const std::string_view from, SRateLimit &Out,
+                                            const SParseLimits &Limits = SParseLimits()) noexcept {
+    // The count is a number too
+    if (from.size() > Limits.m_MaxLength || Limits.m_MaxTokens == 0)
+        return false;
+
+    std::string_view Rest = detail::TrimSpaces(from);
+    size_t Digits = 0;
+    uint64_t Count = 0;
+    for (; Digits < Rest.size() && detail::IsDigitAscii(Rest[Digits]); ++Digits) {
+        const auto Digit = static_cast<uint64_t>(Rest[Digits] - '0');
+        if (Count > (std::numeric_limits<uint64_t>::max() - Digit) / 10)
+            return false;
+        Count = Count * 10 + Digit;
+    }
+    if (Digits == 0 || Count == 0)
+        return false;
+    Rest = detail::TrimSpaces(Rest.substr(Digits));
+
+    if (!Rest.empty() && Rest.front() == '/')
+        Rest.remove_prefix(1);
+    else if (Rest.substr(0, 3) == "per" && Rest.size() > 3 && detail::IsSpaceAscii(Rest[3]))
+        Rest.remove_prefix(3);
+    else
+        return false;
+    Rest = detail::TrimSpaces(Rest);
+
+    std::chrono::seconds Period{0};
+    if (!detail::ParseLoneUnit(Rest, Period)) {
+        if (!CTimePeriod::TryParse(Rest, Period, SParseLimits{Limits.m_MaxLength, Limits.m_MaxTokens - 1}))
+            return false;
+    }
+    if (Period.count() <= 0 || Period.count() > detail::MAX_RATE_PERIOD_SECONDS)
+        return false;
+
+    Out = SRateLimit{Count, CTimePeriod(Period)};
+    return true;
+}
+
+/**
+ * @brief Parse a rate limit spec (see TryParseRateLimit)
+ *
+ * @param from Spec to parse
+ * @return SRateLimit Parsed limit
+ * @throws std::invalid_argument if the spec is rejected
+ */
+[[nodiscard]] inline SRateLimit ParseRateLimit(const std::string_view from) {
+    SRateLimit Result;
+    if (!TryParseRateLimit(from, Result))
+        throw std::invalid_argument("invalid rate limit spec");
+    return Result;
+}
+
+/**
+ * @brief Lock-free rate limiter (GCRA, the virtual-scheduling form of a token bucket)
+ *
+ * The whole state is one atomic theoretical arrival time (TAT) in integer nanoseconds of
+ * ClockT. An acquire that gets a permit costs one load and one successful CAS; a rejected
+ * one costs only the load. Permits are spaced Period / Count apart and up to Burst of them
+ * (default Count, a full bucket) may be taken at once after an idle spell.
+ *
+ * @tparam ClockT Monotonic clock used by the overloads without an explicit time
+ */
+template<typename ClockT = std::chrono::steady_clock>
+class CBasicRateLimiter final {
+public:
+    using TimePoint = typename ClockT::time_point;
+
+private:
+    int64_t m_Interval;  // nanoseconds between permits
+    int64_t m_Tolerance; // how far the TAT may run ahead of now, (Burst - 1) * m_Interval
+    std::atomic<int64_t> m_Tat{std::numeric_limits<int64_t>::min()};
+
+    [[nodiscard]] static int64_t Nanoseconds(const TimePoint Now) noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Now.time_since_epoch()).count();
+    }
+
+public:
+    /**
+     * @param Limit Events per period
+     * @param Burst Permits available at once, 0 means Limit.m_Count
+     * @throws std::invalid_argument if the count is zero, the period is not positive, or the
+     * period is so short that permits would be less than a nanosecond apart
+     * @throws std::out_of_range if the period or the burst window does not fit int64_t nanoseconds
+     */
+    explicit CBasicRateLimiter(const SRateLimit &Limit, uint64_t Burst = 0) {
+        const int64_t Seconds = Limit.m_Period.duration().count();
+        if (Limit.m_Count == 0 || Seconds <= 0)
+            throw std::invalid_argument("rate limit needs a positive count and period");
+        if (Seconds > detail::MAX_RATE_PERIOD_SECONDS)
+            throw std::out_of_range("rate limit period does not fit int64_t nanoseconds");
+
+        const uint64_t Period = static_cast<uint64_t>(Seconds) * 1000000000u;
+        if (Limit.m_Count > Period)
+            throw std::invalid_argument("rate limit finer than one event per nanosecond");
+        m_Interval = static_cast<int64_t>(Period / Limit.m_Count);
+
+        if (Burst == 0)
+            Burst = Limit.m_Count;
+        if (Burst - 1 > static_cast<uint64_t>(std::numeric_limits<int64_t>::max() / m_Interval))
+            throw std::out_of_range("rate limit burst window does not fit int64_t nanoseconds");
+        m_Tolerance = static_cast<int64_t>(Burst - 1) * m_Interval;
+    }
+
+    /**
+     * @param Spec Rate limit spec, see TryParseRateLimit
+     * @param Burst Permits available at once, 0 means the spec's count
+     */
+    explicit CBasicRateLimiter(const std::string_view Spec, const uint64_t Burst = 0)
+        : CBasicRateLimiter(ParseRateLimit(Spec), Burst) {
+    }
+
+    CBasicRateLimiter(const CBasicRateLimiter &) = delete;
+    CBasicRateLimiter &operator=(const CBasicRateLimiter &) = delete;
+
+    /**
+     * @brief Take Cost permits at Now if they are available
+     *
+     * @param Now Current time of ClockT
+     * @param Cost Permits to take at once, at most the burst
+     * @return true if the permits were taken, false if the caller is over the limit (nothing is taken then)
+     */
+    [[nodiscard]] bool TryAcquire(const TimePoint Now, const uint64_t Cost = 1) noexcept {
+        const int64_t Time = Nanoseconds(Now);
+        // Cost beyond the burst can never be granted, keeps the multiplication in range
+        if (Cost == 0 || Cost - 1 > static_cast<uint64_t>(m_Tolerance / m_Interval))
+            return Cost == 0;
+        const int64_t Increment = static_cast<int64_t>(Cost) * m_Interval;
+
+        int64_t Tat = m_Tat.load(std::memory_order_relaxed);
+        for (;;) {
+            const int64_t Start = std::max(Tat, Time);
+            // Start - Time <= m_Tolerance + m_Interval - Increment, rearranged to avoid overflow
+            if (Start - Time > m_Tolerance - (Increment - m_Interval))
+                return false;
+            if (m_Tat.compare_exchange_weak(Tat, Start + Increment, std::memory_order_relaxed))
+                return true;
+        }
+    }
+
+    [[nodiscard]] bool TryAcquire(const uint64_t Cost = 1) noexcept {
+        return TryAcquire(ClockT::now(), Cost);
+    }
+
+    /**
+     * @brief How long a caller has to wait at Now before one permit is available
+     *
+     * @param Now Current time of ClockT
+     * @return std::chrono::nanoseconds Zero if a permit is available right away
+     */
+    [[nodiscard]] std::chrono::nanoseconds TimeUntilAvailable(const TimePoint Now) const noexcept {
+        const int64_t Time = Nanoseconds(Now);
+        const int64_t Tat = m_Tat.load(std::memory_order_relaxed);
+        if (Tat <= Time)
+            return std::chrono::nanoseconds(0);
+        return std::chrono::nanoseconds(std::max<int64_t>(0, Tat - Time - m_Tolerance));
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds TimeUntilAvailable() const noexcept {
+        return TimeUntilAvailable(ClockT::now());
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds Interval() const noexcept {
+        return std::chrono::nanoseconds(m_Interval);
+    }
+};
+
+using CRateLimiter = CBasicRateLimiter<>;
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_RATELIMIT_HPP
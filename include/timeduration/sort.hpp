@@ -0,0 +1,241 @@
+#ifndef TIMEDURATION_SORT_HPP
+#define TIMEDURATION_SORT_HPP
+
+#include <timeduration/timeduration.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace timeduration {
+
+namespace detail {
+    // Below this size the histogram setup costs more than it saves
+    inline constexpr size_t RADIX_SORT_THRESHOLD = 64;
+
+    // Flipping the sign bit maps int64 order onto uint64 order
+    [[nodiscard]] constexpr uint64_t ToRadixKey(const int64_t Total) noexcept {
+        return static_cast<uint64_t>(Total) ^ (uint64_t{1} << 63);
+    }
+
+    [[nodiscard]] constexpr int64_t FromRadixKey(const uint64_t Key) noexcept {
+        return static_cast<int64_t>(Key ^ (uint64_t{1} << 63));
+    }
+
+    /**
+     * @brief Stable LSD radix sort of biased keys, optionally permuting a payload alongside
+     *
+     * Byte columns where every key has the same value are skipped, so durations that fit
+     * in a few bytes only pay for the passes they actually need.
+     */
+    template<typename PayloadT>
+    void RadixSortKeys(uint64_t *Keys, PayloadT *Payload, const size_t Size) {
+        constexpr bool HasPayload = !std::is_void_v<PayloadT>;
+
+        if (Size < RADIX_SORT_THRESHOLD) {
+            // Insertion sort, stable and branch-friendly on tiny inputs
+            for (size_t i = 1; i < Size; ++i) {
+                const uint64_t Key = Keys[i];
+                size_t j = i;
+                if constexpr (HasPayload) {
+                    const PayloadT Value = Payload[i];
+                    for (; j > 0 && Keys[j - 1] > Key; --j) {
+                        Keys[j] = Keys[j - 1];
+                        Payload[j] = Payload[j - 1];
+                    }
+                    Payload[j] = Value;
+                } else {
+                    for (; j > 0 && Keys[j - 1] > Key; --j)
+                        Keys[j] = Keys[j - 1];
+                }
+                Keys[j] = Key;
+            }
+            return;
+        }
+
+        std::array<std::array<size_t, 256>, 8> Counts{};
+        for (size_t i = 0; i < Size; ++i) {
+            const uint64_t Key = Keys[i];
+            for (size_t Byte = 0; Byte < 8; ++Byte)
+                ++Counts[Byte][(Key >> (Byte * 8)) & 0xFF];
+        }
+
+        std::vector<uint64_t> KeysTmp(Size);
+        uint64_t *Src = Keys;
+        uint64_t *Dst = KeysTmp.data();
+
+        using PayloadStorage = std::conditional_t<HasPayload, PayloadT, char>;
+        std::vector<PayloadStorage> PayloadTmp(HasPayload ? Size : 0);
+        PayloadStorage *PaySrc = nullptr;
+        PayloadStorage *PayDst = nullptr;
+        if constexpr (HasPayload) {
+            PaySrc = Payload;
+            PayDst = PayloadTmp.data();
+        }
+
+        for (size_t Byte = 0; Byte < 8; ++Byte) {
+            auto &Column = Counts[Byte];
+            const size_t Shift = Byte * 8;
+            if (Column[(Src[0] >> Shift) & 0xFF] == Size)
+                continue;
+
+            size_t Offset = 0;
+            for (auto &Count: Column) {
+                const size_t Current = Count;
+                Count = Offset;
+                Offset += Current;
+            }
+
+            for (size_t i = 0; i < Size; ++i) {
+                const size_t Slot = Column[(Src[i] >> Shift) & 0xFF]++;
+                Dst[Slot] = Src[i];
+                if constexpr (HasPayload)
+                    PayDst[Slot] = PaySrc[i];
+            }
+
+            std::swap(Src, Dst);
+            if constexpr (HasPayload)
+                std::swap(PaySrc, PayDst);
+        }
+
+        if (Src != Keys) {
+            std::copy(Src, Src + Size, Keys);
+            if constexpr (HasPayload)
+                std::copy(PaySrc, PaySrc + Size, Payload);
+        }
+    }
+
+    template<typename IndexT>
+    void SortPeriods(const std::span<CTimePeriod> Periods) {
+        const size_t Size = Periods.size();
+        std::vector<uint64_t> Keys(Size);
+        std::vector<IndexT> Order(Size);
+        for (size_t i = 0; i < Size; ++i) {
+            Keys[i] = ToRadixKey(Periods[i].duration().count());
+            Order[i] = static_cast<IndexT>(i);
+        }
+
+        RadixSortKeys(Keys.data(), Order.data(), Size);
+
+        std::vector<CTimePeriod> Sorted;
+        Sorted.reserve(Size);
+        for (const IndexT Index: Order)
+            Sorted.push_back(Periods[Index]);
+        std::move(Sorted.begin(), Sorted.end(), Periods.begin());
+    }
+
+    template<typename KeyFn>
+    size_t TopKImpl(const size_t Size, KeyFn &&Key, const std::span<size_t> OutIndices) {
+        const size_t K = std::min(Size, OutIndices.size());
+        if (K == 0)
+            return 0;
+
+        // Ties go to the lower index, matching a stable descending sort
+        const auto Better = [](const std::pair<int64_t, size_t> &Lhs, const std::pair<int64_t, size_t> &Rhs) {
+            return Lhs.first > Rhs.first || (Lhs.first == Rhs.first && Lhs.second < Rhs.second);
+        };
+
+        // Heap with the worst retained candidate on top
+        std::vector<std::pair<int64_t, size_t>> Heap;
+        Heap.reserve(K);
+        for (size_t i = 0; i < K; ++i)
+            Heap.emplace_back(Key(i), i);
+        std::make_heap(Heap.begin(), Heap.end(), Better);
+
+        for (size_t i = K; i < Size; ++i) {
+            // Later indices lose ties, so only a strictly larger value can enter
+            if (const int64_t Value = Key(i); Value > Heap.front().first) {
+                std::pop_heap(Heap.begin(), Heap.end(), Better);
+                Heap.back() = {Value, i};
+                std::push_heap(Heap.begin(), Heap.end(), Better);
+            }
+        }
+
+        std::sort_heap(Heap.begin(), Heap.end(), Better);
+        for (size_t i = 0; i < K; ++i)
+            OutIndices[i] = Heap[i].second;
+        return K;
+    }
+} // namespace detail
+
+/**
+ * @brief Sort raw duration totals (seconds) in ascending order using LSD radix sort
+ *
+ * @param Totals Totals to sort in place
+ */
+inline void SortDurations(const std::span<int64_t> Totals) {
+    auto *Keys = reinterpret_cast<uint64_t *>(Totals.data());
+    for (auto &Key: std::span(Keys, Totals.size()))
+        Key ^= uint64_t{1} << 63;
+    detail::RadixSortKeys<void>(Keys, nullptr, Totals.size());
+    for (auto &Key: std::span(Keys, Totals.size()))
+        Key ^= uint64_t{1} << 63;
+}
+
+/**
+ * @brief Stable ascending sort of raw totals, applying the same permutation to a payload
+ *
+ * @param Totals Totals to sort in place
+ * @param Payload Values moved along with their totals (e.g. row indices), same size as Totals
+ * @throws std::invalid_argument if Payload and Totals differ in size
+ */
+template<typename PayloadT>
+void SortDurations(const std::span<int64_t> Totals, const std::span<PayloadT> Payload) {
+    static_assert(std::is_trivially_copyable_v<PayloadT>, "Payload must be trivially copyable");
+    if (Totals.size() != Payload.size())
+        throw std::invalid_argument("payload size must match the number of totals");
+
+    auto *Keys = reinterpret_cast<uint64_t *>(Totals.data());
+    const size_t Size = Totals.size();
+    for (auto &Key: std::span(Keys, Size))
+        Key ^= uint64_t{1} << 63;
+    detail::RadixSortKeys(Keys, Payload.data(), Size);
+    for (auto &Key: std::span(Keys, Size))
+        Key ^= uint64_t{1} << 63;
+}
+
+/**
+ * @brief Stable ascending sort of CTimePeriod values by total duration
+ *
+ * @param Periods Periods to sort in place
+ */
+inline void SortDurations(const std::span<CTimePeriod> Periods) {
+    if (Periods.size() <= std::numeric_limits<uint32_t>::max())
+        detail::SortPeriods<uint32_t>(Periods);
+    else
+        detail::SortPeriods<size_t>(Periods);
+}
+
+/**
+ * @brief Select the indices of the largest totals, longest first
+ *
+ * @param Totals Totals to select from
+ * @param OutIndices Receives up to OutIndices.size() indices into Totals
+ * @return size_t Number of indices written
+ */
+inline size_t TopK(const std::span<const int64_t> Totals, const std::span<size_t> OutIndices) {
+    return detail::TopKImpl(Totals.size(), [&](const size_t i) { return Totals[i]; }, OutIndices);
+}
+
+/**
+ * @brief Select the indices of the longest periods, longest first
+ *
+ * @param Periods Periods to select from
+ * @param OutIndices Receives up to OutIndices.size() indices into Periods
+ * @return size_t Number of indices written
+ */
+inline size_t TopK(const std::span<const CTimePeriod> Periods, const std::span<size_t> OutIndices) {
+    return detail::TopKImpl(Periods.size(), [&](const size_t i) { return Periods[i].duration().count(); },
+                            OutIndices);
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_SORT_HPP
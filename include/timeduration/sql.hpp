@@ -0,0 +1,169 @@
+#ifndef TIMEDURATION_SQL_HPP
+#define TIMEDURATION_SQL_HPP
+
+#include <timeduration/timeduration.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace timeduration {
+
+/**
+ * @brief SQL flavour of an interval literal
+ */
+enum class ESqlDialect {
+    GENERIC,    // interval 90 second (same as CTimePeriod::asSqlInterval)
+    POSTGRESQL, // interval '90 seconds'
+    MYSQL,      // INTERVAL 90 SECOND
+    CLICKHOUSE, // toIntervalSecond(90)
+    SQLITE,     // 90 (plain seconds, for use with datetime modifiers or unixepoch arithmetic)
+};
+
+namespace detail {
+    struct SSqlAffixes {
+        std::string_view m_Prefix;
+        std::string_view m_Suffix;
+    };
+
+    [[nodiscard]] constexpr SSqlAffixes SqlAffixes(const ESqlDialect Dialect) noexcept {
+        switch (Dialect) {
+            case ESqlDialect::POSTGRESQL: return {"interval '", " seconds'"};
+            case ESqlDialect::MYSQL: return {"INTERVAL ", " SECOND"};
+            case ESqlDialect::CLICKHOUSE: return {"toIntervalSecond(", ")"};
+            case ESqlDialect::SQLITE: return {"", ""};
+            case ESqlDialect::GENERIC: break;
+        }
+        return {"interval ", " second"};
+    }
+
+    [[nodiscard]] constexpr size_t DecimalLength(const int64_t Value) noexcept {
+        uint64_t Magnitude = Value < 0 ? 0 - static_cast<uint64_t>(Value) : static_cast<uint64_t>(Value);
+        size_t Length = Value < 0 ? 2 : 1;
+        while (Magnitude >= 10) {
+            Magnitude /= 10;
+            ++Length;
+        }
+        return Length;
+    }
+
+    // Writes exactly DecimalLength(Value) characters starting at Out
+    inline char *WriteDecimal(char *Out, const int64_t Value, const size_t Length) noexcept {
+        uint64_t Magnitude = Value < 0 ? 0 - static_cast<uint64_t>(Value) : static_cast<uint64_t>(Value);
+        char *End = Out + Length;
+        char *Cursor = End;
+        do {
+            *--Cursor = static_cast<char>('0' + Magnitude % 10);
+            Magnitude /= 10;
+        } while (Magnitude != 0);
+        if (Value < 0)
+            *--Cursor = '-';
+        return End;
+    }
+
+    inline char *WriteSql(char *Out, const SSqlAffixes &Affixes, const int64_t Seconds, const size_t Digits) noexcept {
+        Out = std::copy(Affixes.m_Prefix.begin(), Affixes.m_Prefix.end(), Out);
+        Out = WriteDecimal(Out, Seconds, Digits);
+        return std::copy(Affixes.m_Suffix.begin(), Affixes.m_Suffix.end(), Out);
+    }
+
+    [[nodiscard]] inline size_t SqlIntervalsLength(const std::span<const CTimePeriod> Periods, const SSqlAffixes &Affixes,
+                                                   const std::string_view Separator) noexcept {
+        if (Periods.empty())
+            return 0;
+        size_t Length = (Periods.size() - 1) * Separator.size() +
+                        Periods.size() * (Affixes.m_Prefix.size() + Affixes.m_Suffix.size());
+        for (const auto &Period: Periods)
+            Length += DecimalLength(Period.duration().count());
+        return Length;
+    }
+
+    // Out must have room for SqlIntervalsLength characters
+    inline void WriteSqlIntervalsUnchecked(char *Out, const std::span<const CTimePeriod> Periods,
+                                           const SSqlAffixes &Affixes, const std::string_view Separator) noexcept {
+        for (size_t i = 0; i < Periods.size(); ++i) {
+            if (i != 0)
+                Out = std::copy(Separator.begin(), Separator.end(), Out);
+            const int64_t Seconds = Periods[i].duration().count();
+            Out = WriteSql(Out, Affixes, Seconds, DecimalLength(Seconds));
+        }
+    }
+} // namespace detail
+
+/**
+ * @brief Length of a single interval literal
+ *
+ * @param Dialect SQL dialect
+ * @param Duration Interval value
+ * @return size_t Number of characters WriteSqlInterval will produce
+ */
+[[nodiscard]] constexpr size_t SqlIntervalLength(const ESqlDialect Dialect, const std::chrono::seconds Duration) noexcept {
+    const auto Affixes = detail::SqlAffixes(Dialect);
+    return Affixes.m_Prefix.size() + detail::DecimalLength(Duration.count()) + Affixes.m_Suffix.size();
+}
+
+/**
+ * @brief Write a single interval literal into a caller buffer
+ *
+ * @param Dialect SQL dialect
+ * @param Duration Interval value
+ * @param Buffer Destination
+ * @return size_t Number of characters written, 0 if the buffer is too small
+ */
+[[nodiscard]] inline size_t WriteSqlInterval(const ESqlDialect Dialect, const std::chrono::seconds Duration,
+                                             const std::span<char> Buffer) noexcept {
+    const auto Affixes = detail::SqlAffixes(Dialect);
+    const size_t Digits = detail::DecimalLength(Duration.count());
+    const size_t Length = Affixes.m_Prefix.size() + Digits + Affixes.m_Suffix.size();
+    if (Length > Buffer.size())
+        return 0;
+    detail::WriteSql(Buffer.data(), Affixes, Duration.count(), Digits);
+    return Length;
+}
+
+/**
+ * @brief Append interval literals for a whole span of periods to a string, separated by Separator
+ *
+ * The string grows once to the exact final size and the literals are written in place,
+ * so a multi-megabyte statement costs a single allocation at most.
+ *
+ * @param Out String to append to (std::string, std::pmr::string, ...)
+ * @param Periods Interval values
+ * @param Dialect SQL dialect
+ * @param Separator Text placed between consecutive literals
+ */
+template<typename StringT>
+void AppendSqlIntervals(StringT &Out, const std::span<const CTimePeriod> Periods, const ESqlDialect Dialect,
+                        const std::string_view Separator = ", ") {
+    const auto Affixes = detail::SqlAffixes(Dialect);
+    const size_t Length = detail::SqlIntervalsLength(Periods, Affixes, Separator);
+    const size_t Offset = Out.size();
+    Out.resize(Offset + Length);
+    detail::WriteSqlIntervalsUnchecked(Out.data() + Offset, Periods, Affixes, Separator);
+}
+
+/**
+ * @brief Write interval literals for a whole span of periods into a caller buffer
+ *
+ * @param Buffer Destination
+ * @param Periods Interval values
+ * @param Dialect SQL dialect
+ * @param Separator Text placed between consecutive literals
+ * @return size_t Number of characters written, 0 if the buffer is too small (nothing is written then)
+ */
+[[nodiscard]] inline size_t WriteSqlIntervals(const std::span<char> Buffer, const std::span<const CTimePeriod> Periods,
+                                              const ESqlDialect Dialect, const std::string_view Separator = ", ") noexcept {
+    const auto Affixes = detail::SqlAffixes(Dialect);
+    const size_t Length = detail::SqlIntervalsLength(Periods, Affixes, Separator);
+    if (Length > Buffer.size())
+        return 0;
+    detail::WriteSqlIntervalsUnchecked(Buffer.data(), Periods, Affixes, Separator);
+    return Length;
+}
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_SQL_HPP
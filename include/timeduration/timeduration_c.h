@@ -0,0 +1,86 @@
+#ifndef TIMEDURATION_C_H
+#define TIMEDURATION_C_H
+
+/*
+ * C interface of the timeduration parser, for FFI consumers.
+ *
+ * Provided by the compiled timeduration_c library (CMake option TIMEDURATION_BUILD_C_API).
+ * Parsing uses the native grammar of CTimePeriod ("2h 30m", bare numbers are minutes),
+ * formatting produces CTimePeriod::toString() output ("2d 5h 30m 15s"). No function
+ * allocates or lets an exception escape.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(TIMEDURATION_C_SHARED)
+#if defined(TIMEDURATION_C_EXPORTS)
+#define TD_API __declspec(dllexport)
+#else
+#define TD_API __declspec(dllimport)
+#endif
+#else
+#define TD_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum td_status {
+    TD_OK = 0,
+    TD_ERROR_INVALID_ARGUMENT = 1, /* required pointer was NULL */
+    TD_ERROR_OVERFLOW = 2,         /* value does not fit in int64_t seconds */
+    TD_ERROR_BUFFER_TOO_SMALL = 3,
+    TD_ERROR_NEGATIVE = 4,         /* negative durations have no toString() form, see td_format */
+} td_status;
+
+/* Non-owning string, need not be NUL-terminated */
+typedef struct td_string_view {
+    const char *data;
+    size_t size;
+} td_string_view;
+
+/*
+ * Parse one duration.
+ *
+ * text may be NULL if length is 0. On success *out_seconds receives the total.
+ */
+TD_API td_status td_parse(const char *text, size_t length, int64_t *out_seconds);
+
+/*
+ * Parse count durations in one call.
+ *
+ * out_seconds[i] receives the total of inputs[i], or 0 if it failed. out_status may be
+ * NULL; otherwise out_status[i] receives the status of inputs[i].
+ * Returns the number of inputs parsed successfully.
+ */
+TD_API size_t td_parse_batch(const td_string_view *inputs, size_t count, int64_t *out_seconds,
+                             td_status *out_status);
+
+/*
+ * Format one duration into buffer (not NUL-terminated).
+ *
+ * *out_length receives the formatted length, also when TD_ERROR_BUFFER_TOO_SMALL is
+ * returned, so the caller can retry with a large enough buffer. Negative seconds return
+ * TD_ERROR_NEGATIVE with *out_length 0: toString() drops negative components, so -3600
+ * would otherwise come out as "0s".
+ */
+TD_API td_status td_format(int64_t seconds, char *buffer, size_t capacity, size_t *out_length);
+
+/*
+ * Format count durations back to back into buffer (not NUL-terminated).
+ *
+ * out_offsets must have count + 1 entries; string i is buffer[out_offsets[i], out_offsets[i + 1]).
+ * *out_required receives the total length needed. If it exceeds capacity,
+ * TD_ERROR_BUFFER_TOO_SMALL is returned and the buffer contents are unspecified.
+ * If any value is negative, TD_ERROR_NEGATIVE is returned before anything is written.
+ */
+TD_API td_status td_format_batch(const int64_t *seconds, size_t count, char *buffer, size_t capacity,
+                                 size_t *out_offsets, size_t *out_required);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEDURATION_C_H */
@@ -0,0 +1,14 @@
+#ifndef TIMEDURATION_FWD_HPP
+#define TIMEDURATION_FWD_HPP
+
+/**
+ * Forward declarations only, for headers that pass CTimePeriod by reference or pointer.
+ * Include <timeduration/core.hpp> to hold one by value.
+ */
+namespace timeduration {
+
+class CTimePeriod;
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_FWD_HPP
@@ -0,0 +1,314 @@
+#ifndef TIMEDURATION_TIMEOUT_HPP
+#define TIMEDURATION_TIMEOUT_HPP
+
+#include <timeduration/parse.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace timeduration {
+
+/**
+ * @brief Exponential backoff between an initial and a maximum delay, e.g. 1s, 2s, 4s, ... 5m
+ *
+ * Delays are whole seconds like every CTimePeriod; growth saturates at the maximum.
+ */
+class CBackoff final {
+    int64_t m_Initial;
+    int64_t m_Max;
+    int64_t m_Current;
+    uint32_t m_Factor;
+    uint32_t m_Attempts = 0;
+
+public:
+    /**
+     * @param Initial First delay, must be positive
+     * @param Max Largest delay, at least Initial
+     * @param Factor Growth per attempt, at least 1
+     * @throws std::invalid_argument if the arguments violate the bounds above
+     */
+    CBackoff(const CTimePeriod &Initial, const CTimePeriod &Max, const uint32_t Factor = 2)
+        : m_Initial(Initial.duration().count()), m_Max(Max.duration().count()), m_Current(m_Initial), m_Factor(Factor) {
+        if (m_Initial <= 0 || m_Max < m_Initial || Factor == 0)
+            throw std::invalid_argument("backoff needs 0 < initial <= max and a factor of at least 1");
+    }
+
+    /**
+     * @param Initial First delay in the native grammar, e.g. "1s"
+     * @param Max Largest delay in the native grammar, e.g. "5m"
+     * @param Factor Growth per attempt, at least 1
+     */
+    CBackoff(const std::string_view Initial, const std::string_view Max, const uint32_t Factor = 2)
+        : CBackoff(CTimePeriod(Initial), CTimePeriod(Max), Factor) {
+    }
+
+    /**
+     * @brief Delay before the next attempt; advances the schedule
+     */
+    [[nodiscard]] CTimePeriod Next() noexcept {
+        const int64_t Delay = m_Current;
+        m_Current = m_Current > m_Max / m_Factor ? m_Max : std::min(m_Max, m_Current * m_Factor);
+        ++m_Attempts;
+        return CTimePeriod(std::chrono::seconds(Delay));
+    }
+
+    /**
+     * @brief Start over at the initial delay, e.g. after a success
+     */
+    void Reset() noexcept {
+        m_Current = m_Initial;
+        m_Attempts = 0;
+    }
+
+    [[nodiscard]] uint32_t Attempts() const noexcept {
+        return m_Attempts;
+    }
+};
+
+/**
+ * @brief Counters of a CTimeoutService since construction
+ */
+struct STimeoutStats {
+    uint64_t m_Wakeups = 0;   // times the waiter thread woke up, for any reason
+    uint64_t m_Batches = 0;   // coalesced deadlines that fired
+    uint64_t m_Fired = 0;     // callbacks started
+    uint64_t m_Cancelled = 0; // callbacks cancelled before they ran
+};
+
+/**
+ * @brief Runs callbacks after CTimePeriod delays on one shared waiter thread
+ *
+ * Replaces one sleeping thread per wait. Deadlines are rounded up to a multiple of the slack,
+ * so every wait whose deadline falls into the same slack window is served by one wakeup: a
+ * callback never runs early and at most Slack late (plus scheduling latency). The waiter
+ * blocks on a condition variable and is only notified when a new earliest deadline arrives.
+ *
+ * Callbacks run on the waiter thread, outside the lock, so they may schedule or cancel
+ * timers but should be short; one that throws terminates the program. Timers still pending
+ * when the service is destroyed are dropped without running.
+ */
+class CTimeoutService final {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+
+private:
+    struct STimer {
+        TimerId m_Id;
+        std::function<void()> m_Callback;
+    };
+
+    struct SLocation {
+        Clock::time_point m_Deadline;
+        size_t m_Index;
+    };
+
+    const Clock::duration m_Slack;
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Wakeup;
+    std::map<Clock::time_point, std::vector<STimer>> m_Deadlines;
+    std::unordered_map<TimerId, SLocation> m_Pending;
+    TimerId m_NextId = 1;
+    bool m_Stop = false;
+
+    std::atomic<uint64_t> m_Wakeups{0};
+    std::atomic<uint64_t> m_Batches{0};
+    std::atomic<uint64_t> m_Fired{0};
+    std::atomic<uint64_t> m_Cancelled{0};
+
+    std::thread m_Waiter;
+
+    [[nodiscard]] Clock::time_point Coalesce(const Clock::time_point Deadline) const noexcept {
+        if (m_Slack.count() <= 0)
+            return Deadline;
+        const auto Since = Deadline.time_since_epoch().count();
+        const auto Slack = m_Slack.count();
+        // Round up, toward the future, so nothing fires early
+        const auto Rounded = Since >= 0 && Since % Slack != 0 && Since <= std::numeric_limits<Clock::rep>::max() - Slack
+                                 ? (Since / Slack + 1) * Slack
+                                 : Since;
+        return Clock::time_point(Clock::duration(Rounded));
+    }
+
+    void Run() {
+        std::unique_lock Lock(m_Mutex);
+        while (!m_Stop) {
+            // Idle without timers until one is scheduled. The wait is always timed: steady_clock's
+            // wait_until is inline, while the untimed wait() calls into libstdc++ under a symbol
+            // version added in GCC 12, which an older runtime found at load time does not provide
+            const auto Next = m_Deadlines.begin();
+            const Clock::time_point Deadline = Next == m_Deadlines.end() ? Clock::time_point::max() : Next->first;
+            if (Clock::now() < Deadline) {
+                m_Wakeup.wait_until(Lock, Deadline);
+                m_Wakeups.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            std::vector<STimer> vDue = std::move(Next->second);
+            m_Deadlines.erase(Next);
+            for (const auto &Timer: vDue)
+                m_Pending.erase(Timer.m_Id);
+            m_Batches.fetch_add(1, std::memory_order_relaxed);
+
+            Lock.unlock();
+            for (auto &Timer: vDue) {
+                // Scheduled with an empty function
+                if (!Timer.m_Callback)
+                    continue;
+                // Counted first, so the count is current once a callback has signalled its waiter
+                m_Fired.fetch_add(1, std::memory_order_relaxed);
+                Timer.m_Callback();
+            }
+            // Callback captures are released before the lock is taken again
+            vDue.clear();
+            Lock.lock();
+        }
+    }
+
+public:
+    /**
+     * @param Slack Width of the windows deadlines are coalesced into; zero fires every deadline exactly
+     */
+    explicit CTimeoutService(const Clock::duration Slack = std::chrono::milliseconds(10))
+        : m_Slack(std::max(Slack, Clock::duration::zero())), m_Waiter([this] { Run(); }) {
+    }
+
+    CTimeoutService(const CTimeoutService &) = delete;
+    CTimeoutService &operator=(const CTimeoutService &) = delete;
+
+    ~CTimeoutService() {
+        {
+            const std::lock_guard Lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Wakeup.notify_one();
+        m_Waiter.join();
+    }
+
+    /**
+     * @brief Run Callback on the waiter thread at Deadline, rounded up to the slack
+     *
+     * @return TimerId Handle for Cancel
+     */
+    TimerId Schedule(const Clock::time_point Deadline, std::function<void()> Callback) {
+        const Clock::time_point Coalesced = Coalesce(Deadline);
+        bool Earliest = false;
+        TimerId Id = 0;
+        {
+            const std::lock_guard Lock(m_Mutex);
+            Id = m_NextId++;
+            Earliest = m_Deadlines.empty() || Coalesced < m_Deadlines.begin()->first;
+            auto &vTimers = m_Deadlines[Coalesced];
+            m_Pending.emplace(Id, SLocation{Coalesced, vTimers.size()});
+            vTimers.push_back({Id, std::move(Callback)});
+        }
+        // Later deadlines are picked up when the waiter wakes for the earliest one
+        if (Earliest)
+            m_Wakeup.notify_one();
+        return Id;
+    }
+
+    /**
+     * @brief Run Callback after Delay; delays past the end of the clock's range never fire
+     */
+    TimerId Schedule(const Clock::duration Delay, std::function<void()> Callback) {
+        const Clock::time_point Now = Clock::now();
+        if (Delay <= Clock::duration::zero())
+            return Schedule(Now, std::move(Callback));
+        const Clock::time_point Deadline = Delay > Clock::time_point::max() - Now ? Clock::time_point::max() : Now + Delay;
+        return Schedule(Deadline, std::move(Callback));
+    }
+
+    /**
+     * @brief Run Callback after Delay; periods beyond about 292 years saturate and never fire
+     */
+    TimerId Schedule(const CTimePeriod &Delay, std::function<void()> Callback) {
+        // Clamped in seconds, converting first would overflow the clock's nanoseconds
+        constexpr auto Max = std::chrono::duration_cast<std::chrono::seconds>(Clock::duration::max());
+        const std::chrono::seconds Seconds = std::clamp(Delay.duration(), -Max, Max);
+        return Schedule(std::chrono::duration_cast<Clock::duration>(Seconds), std::move(Callback));
+    }
+
+    /**
+     * @brief Drop a pending callback; its captures are released right away
+     *
+     * The timer is removed from its window, and a window left empty is removed as well, so
+     * cancelled timers cost no memory and no wakeup.
+     *
+     * @return true if the callback had not run yet and now never will
+     */
+    bool Cancel(const TimerId Id) {
+        std::function<void()> Callback;
+        {
+            const std::lock_guard Lock(m_Mutex);
+            const auto It = m_Pending.find(Id);
+            if (It == m_Pending.end())
+                return false;
+            const auto Window = m_Deadlines.find(It->second.m_Deadline);
+            auto &vTimers = Window->second;
+            const size_t Index = It->second.m_Index;
+            Callback = std::move(vTimers[Index].m_Callback);
+            // Swap with the last timer of the window and pop
+            if (Index + 1 != vTimers.size()) {
+                vTimers[Index] = std::move(vTimers.back());
+                m_Pending.find(vTimers[Index].m_Id)->second.m_Index = Index;
+            }
+            vTimers.pop_back();
+            if (vTimers.empty())
+                m_Deadlines.erase(Window);
+            m_Pending.erase(It);
+        }
+        // Callback captures are released here, outside the lock
+        m_Cancelled.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Block the calling thread for Delay, woken by the shared waiter
+     */
+    void SleepFor(const CTimePeriod &Delay) {
+        std::mutex Mutex;
+        std::condition_variable Done;
+        bool Expired = false;
+        Schedule(Delay, [&] {
+            const std::lock_guard Lock(Mutex);
+            Expired = true;
+            Done.notify_one();
+        });
+        std::unique_lock Lock(Mutex);
+        Done.wait_until(Lock, Clock::time_point::max(), [&] { return Expired; });
+    }
+
+    [[nodiscard]] size_t Pending() const {
+        const std::lock_guard Lock(m_Mutex);
+        return m_Pending.size();
+    }
+
+    [[nodiscard]] Clock::duration Slack() const noexcept {
+        return m_Slack;
+    }
+
+    [[nodiscard]] STimeoutStats Stats() const noexcept {
+        return {m_Wakeups.load(std::memory_order_relaxed), m_Batches.load(std::memory_order_relaxed),
+                m_Fired.load(std::memory_order_relaxed), m_Cancelled.load(std::memory_order_relaxed)};
+    }
+};
+
+} // namespace timeduration
+
+#endif // TIMEDURATION_TIMEOUT_HPP
@@ -0,0 +1,22 @@
+// C++20 module interface for the core API: import timeduration;
+module;
+
+#include <timeduration/timeduration.hpp>
+
+export module timeduration;
+
+export namespace timeduration {
+    using timeduration::CTimePeriod;
+    using timeduration::ENativeUnit;
+    using timeduration::UNIT_SECONDS;
+    using timeduration::UNIT_MINUTES;
+    using timeduration::UNIT_HOURS;
+    using timeduration::UNIT_DAYS;
+    using timeduration::UNIT_MONTHS;
+    using timeduration::UNIT_YEARS;
+    using timeduration::NUM_NATIVE_UNITS;
+    using timeduration::NATIVE_UNIT_SECONDS;
+    using timeduration::SParsedComponents;
+    using timeduration::SParseLimits;
+    using timeduration::UNTRUSTED_INPUT_LIMITS;
+}
@@ -0,0 +1,103 @@
+#include <timeduration/timeduration_c.h>
+#include <timeduration/timeduration.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+using timeduration::CTimePeriod;
+
+namespace {
+    // Formats into a stack arena; longest output is "106751991167300d 15h 30m 7s"
+    class CFormatter final {
+        alignas(std::max_align_t) char m_aArena[256];
+
+    public:
+        template<typename FnT>
+        td_status Format(const int64_t Seconds, FnT &&Consume) noexcept {
+            try {
+                std::pmr::monotonic_buffer_resource Arena(m_aArena, sizeof(m_aArena), std::pmr::null_memory_resource());
+                const auto Text = CTimePeriod(std::chrono::seconds(Seconds)).toString(&Arena);
+                return Consume(Text.data(), Text.size());
+            } catch (...) {
+                // Unreachable with the arena above, but nothing may cross the C boundary
+                return TD_ERROR_BUFFER_TOO_SMALL;
+            }
+        }
+    };
+}
+
+extern "C" {
+
+td_status td_parse(const char *text, const size_t length, int64_t *out_seconds) {
+    if (!out_seconds || (!text && length != 0))
+        return TD_ERROR_INVALID_ARGUMENT;
+    std::chrono::seconds Value{0};
+    if (!CTimePeriod::TryParse(std::string_view(text, length), Value))
+        return TD_ERROR_OVERFLOW;
+    *out_seconds = Value.count();
+    return TD_OK;
+}
+
+size_t td_parse_batch(const td_string_view *inputs, const size_t count, int64_t *out_seconds,
+                      td_status *out_status) {
+    if (count == 0 || !inputs || !out_seconds)
+        return 0;
+
+    size_t Parsed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        out_seconds[i] = 0;
+        const td_status Status = td_parse(inputs[i].data, inputs[i].size, &out_seconds[i]);
+        Parsed += Status == TD_OK;
+        if (out_status)
+            out_status[i] = Status;
+    }
+    return Parsed;
+}
+
+td_status td_format(const int64_t seconds, char *buffer, const size_t capacity, size_t *out_length) {
+    if (!out_length || (!buffer && capacity != 0))
+        return TD_ERROR_INVALID_ARGUMENT;
+    if (seconds < 0) {
+        *out_length = 0;
+        return TD_ERROR_NEGATIVE;
+    }
+    CFormatter Formatter;
+    return Formatter.Format(seconds, [&](const char *pText, const size_t Length) {
+        *out_length = Length;
+        if (Length > capacity)
+            return TD_ERROR_BUFFER_TOO_SMALL;
+        std::copy_n(pText, Length, buffer);
+        return TD_OK;
+    });
+}
+
+td_status td_format_batch(const int64_t *seconds, const size_t count, char *buffer, const size_t capacity,
+                          size_t *out_offsets, size_t *out_required) {
+    if (!out_offsets || !out_required || (!seconds && count != 0) || (!buffer && capacity != 0))
+        return TD_ERROR_INVALID_ARGUMENT;
+    if (std::any_of(seconds, seconds + count, [](const int64_t Value) { return Value < 0; }))
+        return TD_ERROR_NEGATIVE;
+
+    CFormatter Formatter;
+    size_t Offset = 0;
+    for (size_t i = 0; i < count; ++i) {
+        out_offsets[i] = Offset;
+        const td_status Status = Formatter.Format(seconds[i], [&](const char *pText, const size_t Length) {
+            // Keep measuring once the buffer is full so the caller learns the required size
+            if (Offset + Length <= capacity)
+                std::copy_n(pText, Length, buffer + Offset);
+            Offset += Length;
+            return TD_OK;
+        });
+        if (Status != TD_OK)
+            return Status;
+    }
+    out_offsets[count] = Offset;
+    *out_required = Offset;
+    return Offset <= capacity ? TD_OK : TD_ERROR_BUFFER_TOO_SMALL;
+}
+
+} // extern "C"
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <timeduration/ascii.hpp>
+#include <timeduration/expression.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <cctype>
+#include <chrono>
+#include <clocale>
+#include <stdexcept>
+#include <string>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    // Restores the global C locale when the test ends
+    class CLocaleGuard final {
+        std::string m_Previous;
+
+    public:
+        explicit CLocaleGuard(const char *pName) : m_Previous(std::setlocale(LC_ALL, nullptr)) {
+            std::setlocale(LC_ALL, pName);
+        }
+
+        ~CLocaleGuard() {
+            std::setlocale(LC_ALL, m_Previous.c_str());
+        }
+    };
+}
+
+TEST(AsciiTest, MatchesCLocaleForAscii) {
+    for (int c = 0; c < 0x80; ++c) {
+        const char Char = static_cast<char>(c);
+        EXPECT_EQ(detail::IsDigitAscii(Char), isdigit(c) != 0) << c;
+        EXPECT_EQ(detail::IsAlphaAscii(Char), isalpha(c) != 0) << c;
+        EXPECT_EQ(detail::IsUnitChar(Char), isalpha(c) != 0) << c;
+        EXPECT_EQ(detail::ToUpperAscii(Char), static_cast<char>(toupper(c))) << c;
+    }
+    EXPECT_TRUE(detail::IsSpaceAscii(' '));
+    EXPECT_TRUE(detail::IsSpaceAscii('\t'));
+    EXPECT_FALSE(detail::IsSpaceAscii('\n'));
+}
+
+TEST(AsciiTest, HighBytesAreUnitCharactersOnly) {
+    for (int c = 0x80; c <= 0xFF; ++c) {
+        const char Char = static_cast<char>(c);
+        EXPECT_FALSE(detail::IsDigitAscii(Char)) << c;
+        EXPECT_FALSE(detail::IsAlphaAscii(Char)) << c;
+        EXPECT_FALSE(detail::IsSpaceAscii(Char)) << c;
+        EXPECT_TRUE(detail::IsUnitChar(Char)) << c;
+        EXPECT_EQ(detail::ToUpperAscii(Char), Char) << c;
+    }
+    static_assert(detail::IsDigitAscii('7') && !detail::IsDigitAscii('\xB5'));
+}
+
+// A UTF-8 unit is one unknown unit, its number is dropped instead of being read as minutes
+TEST(AsciiTest, Utf8UnitsAreUnknownUnits) {
+    for (const char *pInput: {"5\xC2\xB5s 1h", "5\xCE\xBCs 1h", "1h 7\xE2\x80\x8B", "1h 9\xFF"}) {
+        EXPECT_EQ(CTimePeriod::Parse(pInput), 1h) << pInput;
+        std::chrono::seconds Out{0};
+        ASSERT_TRUE(CTimePeriod::TryParse(pInput, Out)) << pInput;
+        EXPECT_EQ(Out, 1h) << pInput;
+        EXPECT_EQ(CTimePeriod(pInput).duration(), 1h) << pInput;
+    }
+    // Not digits either: the bytes of "\xD9\xA3" (Arabic-Indic three) do not start a number
+    EXPECT_EQ(CTimePeriod::Parse("\xD9\xA3h 2s"), 2s);
+
+    EXPECT_THROW((void)CExpression::Compile("5\xC2\xB5s + 1h"), std::invalid_argument);
+}
+
+TEST(AsciiTest, IgnoresTheGlobalLocale) {
+    const std::chrono::seconds Expected = CTimePeriod::Parse("1h 30m 5\xC2\xB5s 20s");
+    const CLocaleGuard Guard("C.UTF-8");
+    EXPECT_EQ(CTimePeriod::Parse("1h 30m 5\xC2\xB5s 20s"), Expected);
+    std::chrono::seconds Out{0};
+    ASSERT_TRUE(CTimePeriod::TryParse("1h 30m 5\xC2\xB5s 20s", Out));
+    EXPECT_EQ(Out, Expected);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <timeduration/atomic.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+TEST(AtomicTest, AtomicDurationAddsAndExchanges) {
+    CAtomicDuration Total(10s);
+    Total.Add(5s);
+    Total.Add(CTimePeriod(0, 2));
+    EXPECT_EQ(Total.Load(), 135s);
+    EXPECT_EQ(Total.Period(), CTimePeriod(15, 2));
+
+    EXPECT_EQ(Total.Exchange(0s), 135s);
+    EXPECT_EQ(Total.Load(), 0s);
+    Total.Store(1h);
+    EXPECT_EQ(Total.Period().hours(), 1);
+}
+
+TEST(AtomicTest, ShardCountIsPowerOfTwo) {
+    EXPECT_EQ(CDurationAccumulator(1).ShardCount(), 1u);
+    EXPECT_EQ(CDurationAccumulator(5).ShardCount(), 8u);
+    EXPECT_EQ(CDurationAccumulator(64).ShardCount(), 64u);
+    const size_t Default = CDurationAccumulator().ShardCount();
+    EXPECT_GE(Default, 1u);
+    EXPECT_EQ(Default & (Default - 1), 0u);
+}
+
+TEST(AtomicTest, AccumulatorCombinesOnRead) {
+    CDurationAccumulator Total(4);
+    Total.Add(90s);
+    Total.Add(CTimePeriod("1h"));
+    EXPECT_EQ(Total.Load(), 3690s);
+    EXPECT_EQ(Total.Period().toString(), CTimePeriod(3690s).toString());
+
+    EXPECT_EQ(Total.TakeAndReset(), 3690s);
+    EXPECT_EQ(Total.Load(), 0s);
+    Total.Add(-5s);
+    EXPECT_EQ(Total.Load(), -5s);
+}
+
+TEST(AtomicTest, ConcurrentAddsAreNotLost) {
+    constexpr int NUM_THREADS = 8;
+    constexpr int NUM_ADDS = 20000;
+
+    CAtomicDuration Atomic;
+    CDurationAccumulator Sharded(2); // fewer shards than threads, shards are shared
+    std::vector<std::thread> vThreads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        vThreads.emplace_back([&Atomic, &Sharded, t] {
+            for (int i = 0; i < NUM_ADDS; ++i) {
+                Atomic.Add(std::chrono::seconds(t + 1));
+                Sharded.Add(std::chrono::seconds(t + 1));
+            }
+        });
+    }
+    for (auto &Thread: vThreads)
+        Thread.join();
+
+    const auto Expected = std::chrono::seconds(int64_t{NUM_ADDS} * NUM_THREADS * (NUM_THREADS + 1) / 2);
+    EXPECT_EQ(Atomic.Load(), Expected);
+    EXPECT_EQ(Sharded.Load(), Expected);
+}
+
+TEST(AtomicTest, TakeAndResetLosesNothingUnderContention) {
+    constexpr int NUM_ADDS = 50000;
+
+    CDurationAccumulator Sharded(4);
+    std::atomic<bool> Done{false};
+    std::thread Writer([&Sharded, &Done] {
+        for (int i = 0; i < NUM_ADDS; ++i)
+            Sharded.Add(1s);
+        Done.store(true);
+    });
+
+    std::chrono::seconds Taken{0};
+    while (!Done.load())
+        Taken += Sharded.TakeAndReset();
+    Writer.join();
+    Taken += Sharded.TakeAndReset();
+    EXPECT_EQ(Taken, std::chrono::seconds(NUM_ADDS));
+}
@@ -0,0 +1,82 @@
+/* Plain C consumer of timeduration_c.h, also checks that the header compiles as C */
+#include <timeduration/timeduration_c.h>
+
+#include <stdio.h>
+#include <string.h>
+
+static int g_Failures = 0;
+
+#define CHECK(Condition)                                                  \
+    do {                                                                  \
+        if (!(Condition)) {                                               \
+            fprintf(stderr, "%s:%d: CHECK(%s)\n", __FILE__, __LINE__, #Condition); \
+            ++g_Failures;                                                 \
+        }                                                                 \
+    } while (0)
+
+static void TestParse(void) {
+    int64_t Seconds = -1;
+    CHECK(td_parse("2h 30m", 6, &Seconds) == TD_OK && Seconds == 9000);
+    CHECK(td_parse("15", 2, &Seconds) == TD_OK && Seconds == 900);
+    CHECK(td_parse("1h 30m", 2, &Seconds) == TD_OK && Seconds == 3600); /* length is honoured */
+    CHECK(td_parse(NULL, 0, &Seconds) == TD_OK && Seconds == 0);
+    CHECK(td_parse("99999999999999999999s", 21, &Seconds) == TD_ERROR_OVERFLOW);
+    CHECK(td_parse("1h", 2, NULL) == TD_ERROR_INVALID_ARGUMENT);
+    CHECK(td_parse(NULL, 3, &Seconds) == TD_ERROR_INVALID_ARGUMENT);
+}
+
+static void TestParseBatch(void) {
+    const td_string_view Inputs[] = {{"1d", 2}, {"99999999999999999999s", 21}, {"45s", 3}, {NULL, 0}};
+    int64_t Seconds[4];
+    td_status Status[4];
+    CHECK(td_parse_batch(Inputs, 4, Seconds, Status) == 3);
+    CHECK(Seconds[0] == 86400 && Status[0] == TD_OK);
+    CHECK(Seconds[1] == 0 && Status[1] == TD_ERROR_OVERFLOW);
+    CHECK(Seconds[2] == 45 && Status[2] == TD_OK);
+    CHECK(Seconds[3] == 0 && Status[3] == TD_OK);
+    CHECK(td_parse_batch(Inputs, 4, Seconds, NULL) == 3);
+    CHECK(td_parse_batch(NULL, 4, Seconds, NULL) == 0);
+}
+
+static void TestFormat(void) {
+    char Buffer[64];
+    size_t Length = 0;
+    CHECK(td_format(189015, Buffer, sizeof(Buffer), &Length) == TD_OK);
+    CHECK(Length == 13 && memcmp(Buffer, "2d 4h 30m 15s", 13) == 0);
+    CHECK(td_format(0, Buffer, sizeof(Buffer), &Length) == TD_OK && Length == 2 && memcmp(Buffer, "0s", 2) == 0);
+    CHECK(td_format(INT64_MAX, Buffer, sizeof(Buffer), &Length) == TD_OK);
+    CHECK(Length == 27 && memcmp(Buffer, "106751991167300d 15h 30m 7s", 27) == 0);
+    CHECK(td_format(3600, Buffer, 1, &Length) == TD_ERROR_BUFFER_TOO_SMALL && Length == 2);
+    CHECK(td_format(-3600, Buffer, sizeof(Buffer), &Length) == TD_ERROR_NEGATIVE && Length == 0);
+    CHECK(td_format(INT64_MIN, Buffer, sizeof(Buffer), &Length) == TD_ERROR_NEGATIVE && Length == 0);
+}
+
+static void TestFormatBatch(void) {
+    const int64_t Seconds[] = {60, 3600, 5};
+    char Buffer[16];
+    size_t Offsets[4];
+    size_t Required = 0;
+    CHECK(td_format_batch(Seconds, 3, Buffer, sizeof(Buffer), Offsets, &Required) == TD_OK);
+    CHECK(Required == 6);
+    CHECK(Offsets[0] == 0 && Offsets[1] == 2 && Offsets[2] == 4 && Offsets[3] == 6);
+    CHECK(memcmp(Buffer, "1m1h5s", 6) == 0);
+
+    CHECK(td_format_batch(Seconds, 3, Buffer, 3, Offsets, &Required) == TD_ERROR_BUFFER_TOO_SMALL);
+    CHECK(Required == 6);
+    CHECK(td_format_batch(Seconds, 0, NULL, 0, Offsets, &Required) == TD_OK && Required == 0 && Offsets[0] == 0);
+
+    const int64_t Mixed[] = {60, -65, 5};
+    memset(Buffer, 'x', sizeof(Buffer));
+    CHECK(td_format_batch(Mixed, 3, Buffer, sizeof(Buffer), Offsets, &Required) == TD_ERROR_NEGATIVE);
+    CHECK(Buffer[0] == 'x');
+}
+
+int main(void) {
+    TestParse();
+    TestParseBatch();
+    TestFormat();
+    TestFormatBatch();
+    if (g_Failures != 0)
+        fprintf(stderr, "%d check(s) failed\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <timeduration/calendar.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono;
+
+namespace {
+    sys_seconds At(const year_month_day Date, const seconds TimeOfDay = seconds(0)) {
+        return sys_days(Date) + TimeOfDay;
+    }
+
+    // Reference: std::chrono calendar arithmetic, clamped to the last day of the month
+    sys_seconds ReferenceAdd(const sys_seconds Time, const SCalendarPeriod &Period) {
+        const sys_days Day = floor<days>(Time);
+        year_month_day Date = year_month_day(Day) + months(Period.m_Months);
+        if (!Date.ok())
+            Date = Date.year() / Date.month() / last;
+        return sys_days(Date) + (Time - Day) + Period.m_Exact;
+    }
+}
+
+TEST(CalendarTest, ParseKeepsMonthsAndYearsSymbolic) {
+    SCalendarPeriod Period;
+    ASSERT_TRUE(TryParseCalendar("1y 2mo 3d 4h 5m 6s", Period));
+    EXPECT_EQ(Period.m_Months, 14);
+    EXPECT_EQ(Period.m_Exact.count(), 3 * 86400 + 4 * 3600 + 5 * 60 + 6);
+
+    ASSERT_TRUE(TryParseCalendar("2months 1years 30", Period));
+    EXPECT_EQ(Period.m_Months, 14);
+    EXPECT_EQ(Period.m_Exact.count(), 1800);
+
+    ASSERT_TRUE(TryParseCalendar("", Period));
+    EXPECT_EQ(Period.m_Months, 0);
+    EXPECT_EQ(Period.m_Exact.count(), 0);
+}
+
+TEST(CalendarTest, ParseRejectsOverflowAndLimits) {
+    SCalendarPeriod Period;
+    EXPECT_FALSE(TryParseCalendar("768614336404564651y", Period));
+    EXPECT_TRUE(TryParseCalendar("768614336404564650y", Period));
+    EXPECT_FALSE(TryParseCalendar("9223372036854775807mo 1mo", Period));
+    EXPECT_FALSE(TryParseCalendar("106751991167301d", Period));
+    EXPECT_FALSE(TryParseCalendar(std::string(300, ' ') + "1mo", Period, UNTRUSTED_INPUT_LIMITS));
+}
+
+TEST(CalendarTest, CivilDaysRoundTrip) {
+    for (int64_t Days = -800000; Days <= 800000; Days += 7) {
+        const auto Date = detail::CivilFromDays(Days);
+        EXPECT_EQ(detail::DaysFromCivil(Date), Days);
+
+        const year_month_day Expected{sys_days{days{Days}}};
+        ASSERT_EQ(Date.m_Year, static_cast<int>(Expected.year()));
+        ASSERT_EQ(Date.m_Month, static_cast<unsigned>(Expected.month()));
+        ASSERT_EQ(Date.m_Day, static_cast<unsigned>(Expected.day()));
+    }
+    static_assert(detail::DaysFromCivil({1970, 1, 1}) == 0);
+    static_assert(detail::FastDaysFromCivil({1970 + detail::FAST_YEAR_SHIFT, 1, 1}) == 0);
+    static_assert(detail::DaysFromCivil({2000, 3, 1}) == 11017);
+    static_assert(detail::CivilFromDays(-1).m_Year == 1969);
+}
+
+TEST(CalendarTest, FastPathMatchesGeneralPath) {
+    const auto General = [](const int64_t Days, const int64_t Months) {
+        const auto Date = detail::CivilFromDays(Days);
+        const int64_t Index = Date.m_Year * 12 + Date.m_Month - 1 + Months;
+        const int64_t Year = detail::FloorDiv(Index, 12);
+        const int64_t Month = Index - Year * 12 + 1;
+        return detail::DaysFromCivil({Year, Month, std::min(Date.m_Day, detail::LastDayOfMonth(Year, Month))});
+    };
+    for (const int64_t Days: {detail::FAST_MIN_DAYS, detail::FAST_MIN_DAYS + 59, int64_t{-1}, int64_t{0}, int64_t{19782},
+                              detail::FAST_MAX_DAYS - 1, detail::FAST_MAX_DAYS}) {
+        for (const int64_t Months: {-detail::FAST_MAX_MONTHS, int64_t{-13}, int64_t{0}, int64_t{1}, detail::FAST_MAX_MONTHS})
+            EXPECT_EQ(detail::AddMonthsToDays(Days, Months), General(Days, Months)) << Days << " " << Months;
+    }
+    for (int64_t Days = detail::FAST_MIN_DAYS; Days <= detail::FAST_MAX_DAYS; Days += 997) {
+        const auto Fast = detail::FastCivilFromDays(Days);
+        const auto Date = detail::CivilFromDays(Days);
+        ASSERT_EQ(Fast.m_Year - detail::FAST_YEAR_SHIFT, Date.m_Year);
+        ASSERT_EQ(Fast.m_Month, Date.m_Month);
+        ASSERT_EQ(Fast.m_Day, Date.m_Day);
+        ASSERT_EQ(detail::FastDaysFromCivil(Fast), Days);
+    }
+
+    // Far outside the fast range
+    const sys_seconds Distant{seconds(int64_t{1} << 50)};
+    EXPECT_EQ(AddCalendar(AddCalendar(Distant, SCalendarPeriod{12 * 400, seconds(0)}), SCalendarPeriod{-12 * 400, seconds(0)}),
+              Distant);
+    EXPECT_EQ(AddCalendar(Distant, SCalendarPeriod{12 * 400, seconds(0)}) - Distant, days(146097));
+}
+
+TEST(CalendarTest, ClampsToEndOfMonth) {
+    const SCalendarPeriod OneMonth{1, seconds(0)};
+    EXPECT_EQ(AddCalendar(At(2024y / January / 31), OneMonth), At(2024y / February / 29));
+    EXPECT_EQ(AddCalendar(At(2023y / January / 31), OneMonth), At(2023y / February / 28));
+    EXPECT_EQ(AddCalendar(At(2023y / March / 31), OneMonth), At(2023y / April / 30));
+    EXPECT_EQ(AddCalendar(At(2023y / December / 15), OneMonth), At(2024y / January / 15));
+
+    const SCalendarPeriod OneYear{12, seconds(0)};
+    EXPECT_EQ(AddCalendar(At(2024y / February / 29), OneYear), At(2025y / February / 28));
+    EXPECT_EQ(AddCalendar(At(2024y / February / 29), SCalendarPeriod{48, seconds(0)}), At(2028y / February / 29));
+}
+
+TEST(CalendarTest, KeepsTimeOfDayAndAddsExactAfterMonths) {
+    SCalendarPeriod Period;
+    ASSERT_TRUE(TryParseCalendar("1mo 1d 2h", Period));
+    // Jan 31 -> Feb 29 (clamped) -> Mar 1, 10:30 -> 12:30
+    EXPECT_EQ(AddCalendar(At(2024y / January / 31, hours(10) + minutes(30)), Period),
+              At(2024y / March / 1, hours(12) + minutes(30)));
+}
+
+TEST(CalendarTest, NegativePeriodsAndPreEpochDates) {
+    EXPECT_EQ(AddCalendar(At(2024y / March / 31), SCalendarPeriod{-1, seconds(0)}), At(2024y / February / 29));
+    EXPECT_EQ(AddCalendar(At(1970y / January / 15, hours(1)), SCalendarPeriod{-1, seconds(0)}),
+              At(1969y / December / 15, hours(1)));
+    EXPECT_EQ(AddCalendar(At(1900y / March / 1, seconds(5)), SCalendarPeriod{-12, seconds(-10)}),
+              At(1899y / February / 28, seconds(86395)));
+}
+
+TEST(CalendarTest, MatchesChronoReference) {
+    for (const int64_t Months: {-1200, -25, -13, -12, -1, 0, 1, 2, 11, 12, 13, 59, 1200}) {
+        const SCalendarPeriod Period{Months, seconds(3723)};
+        for (int64_t Day = -40000; Day <= 40000; Day += 13) {
+            const sys_seconds Time = sys_days{days{Day}} + seconds(Day % 86400 < 0 ? -(Day % 86400) : Day % 86400);
+            ASSERT_EQ(AddCalendar(Time, Period), ReferenceAdd(Time, Period)) << "day " << Day << " months " << Months;
+        }
+    }
+}
+
+TEST(CalendarTest, BatchMatchesScalar) {
+    std::vector<sys_seconds> Input;
+    for (int64_t i = 0; i < 5000; ++i)
+        Input.push_back(sys_seconds{seconds(i * 7919 * 97 - 200000000)});
+    // Runs of the same day exercise the cache
+    for (int64_t i = 0; i < 100; ++i)
+        Input.push_back(At(2024y / January / 31, seconds(i * 60)));
+    // Few distinct days, unordered: goes through the day table
+    std::vector<sys_seconds> Dense;
+    for (int64_t i = 0; i < 4000; ++i)
+        Dense.push_back(At(2024y / January / 1, seconds((i * 7919) % (400 * 86400) - 86400 * 30)));
+
+    for (const auto *pBatch: {&Input, &Dense}) {
+        for (const SCalendarPeriod &Period: {SCalendarPeriod{0, seconds(90)}, SCalendarPeriod{1, seconds(0)},
+                                             SCalendarPeriod{-7, seconds(-86400)}, SCalendarPeriod{25, seconds(5)}}) {
+            std::vector<sys_seconds> Output(pBatch->size());
+            AddCalendar(*pBatch, Period, Output);
+            for (size_t i = 0; i < pBatch->size(); ++i)
+                ASSERT_EQ(Output[i], AddCalendar((*pBatch)[i], Period)) << i;
+
+            // In place
+            std::vector<sys_seconds> InPlace = *pBatch;
+            AddCalendar(InPlace, Period, InPlace);
+            EXPECT_EQ(InPlace, Output);
+        }
+    }
+}
+
+TEST(CalendarTest, BatchRejectsASmallerOutput) {
+    const std::vector<sys_seconds> Input(3, At(2024y / January / 31, seconds(0)));
+    std::vector<sys_seconds> Output(2);
+    for (const SCalendarPeriod &Period: {SCalendarPeriod{0, seconds(90)}, SCalendarPeriod{1, seconds(0)}})
+        EXPECT_THROW(AddCalendar(Input, Period, Output), std::invalid_argument);
+    EXPECT_EQ(Output, std::vector<sys_seconds>(2));
+
+    // A larger output is fine, the tail is left alone
+    Output.assign(4, sys_seconds{});
+    AddCalendar(Input, SCalendarPeriod{1, seconds(0)}, Output);
+    EXPECT_EQ(Output[2], At(2024y / February / 29, seconds(0)));
+    EXPECT_EQ(Output[3], sys_seconds{});
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <timeduration/canonical.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <string>
+#include <string_view>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    std::string Canonical(const std::chrono::seconds Duration) {
+        char Buffer[DISPLAY_MAX_LENGTH];
+        return {Buffer, FormatCanonical(Duration, Buffer)};
+    }
+
+    std::string KeyText(const uint64_t Key) {
+        std::string Text(static_cast<size_t>(Key >> 56), '\0');
+        for (size_t i = 0; i < Text.size(); ++i)
+            Text[i] = static_cast<char>(Key >> (8 * i));
+        return Text;
+    }
+}
+
+TEST(CanonicalTest, FormatsEveryValueBelowADayLikeToString) {
+    for (int64_t Seconds = 0; Seconds < 86400; ++Seconds)
+        ASSERT_EQ(Canonical(std::chrono::seconds(Seconds)), CTimePeriod(std::chrono::seconds(Seconds)).toString()) << Seconds;
+}
+
+TEST(CanonicalTest, FallsBackAboveADay) {
+    for (const auto Duration: {86400s, 86401s, 2 * 86400s + 5h + 30min + 15s, 1000 * 86400s + 59s, -1s, -59s, -60s,
+                               -65s, -3600s, -86400s, -90000s, -(1000 * 86400s + 59s), std::chrono::seconds::min()})
+        EXPECT_EQ(Canonical(Duration), CTimePeriod(Duration).toString()) << Duration.count();
+    EXPECT_EQ(Canonical(-65s), "-5s");
+    EXPECT_EQ(Canonical(-3600s), "0s");
+    EXPECT_EQ(ToCanonicalString(CTimePeriod("1h 30m")), "1h 30m");
+}
+
+TEST(CanonicalTest, RejectsShortBuffers) {
+    std::array<char, 6> Buffer{};
+    EXPECT_EQ(FormatCanonical(1h + 30min + 1s, Buffer), 0u);
+    EXPECT_EQ(FormatCanonical(1h + 30min, Buffer), 6u);
+    EXPECT_EQ(std::string_view(Buffer.data(), 6), "1h 30m");
+    EXPECT_EQ(FormatCanonical(-65s, std::span(Buffer).first(2)), 0u);
+    EXPECT_EQ(FormatCanonical(-65s, std::span(Buffer).first(3)), 3u);
+    EXPECT_EQ(std::string_view(Buffer.data(), 3), "-5s");
+}
+
+// Every table entry must be what the scanner reads
+TEST(CanonicalTest, TableAgreesWithTryParse) {
+    const auto &Table = detail::COMMON_TABLE;
+    size_t Entries = 0;
+    for (size_t Slot = 0; Slot < Table.m_aKeys.size(); ++Slot) {
+        if (Table.m_aKeys[Slot] == 0)
+            continue;
+        ++Entries;
+        const std::string Text = KeyText(Table.m_aKeys[Slot]);
+        std::chrono::seconds Expected{0};
+        ASSERT_TRUE(CTimePeriod::TryParse(Text, Expected)) << Text;
+        EXPECT_EQ(std::chrono::seconds(Table.m_aSeconds[Slot]), Expected) << Text;
+
+        std::chrono::seconds Found{0};
+        EXPECT_TRUE(detail::LookupCommon(Text, Found)) << Text;
+    }
+    EXPECT_EQ(Entries, Table.m_Entries);
+    EXPECT_GT(Entries, 300u);
+}
+
+TEST(CanonicalTest, TryParseCommonMatchesTryParse) {
+    for (const std::string_view Input: {"0s", "30s", "5m", "1h 30m", "23h 45m", "24h", "31d", "90s", "7d",
+                                        "2h 17m 3s", "90", "1h30m", "32d", "", "abc", "5s\0", "1h 30m ",
+                                        "1y 2mo", "9999999999999999999s", "30S"}) {
+        std::chrono::seconds Expected{0};
+        std::chrono::seconds Actual{0};
+        const bool ExpectedOk = CTimePeriod::TryParse(Input, Expected);
+        EXPECT_EQ(TryParseCommon(Input, Actual), ExpectedOk) << Input;
+        if (ExpectedOk) {
+            EXPECT_EQ(Actual, Expected) << Input;
+        }
+    }
+
+    std::chrono::seconds Out{0};
+    EXPECT_TRUE(detail::LookupCommon("1h 30m", Out));
+    EXPECT_EQ(Out, 5400s);
+    EXPECT_FALSE(detail::LookupCommon("2h 17m 3s", Out));
+    EXPECT_FALSE(detail::LookupCommon(std::string_view("5s\0", 3), Out));
+}
+
+TEST(CanonicalTest, TryParseCommonHonoursLimits) {
+    std::chrono::seconds Out{0};
+    EXPECT_FALSE(TryParseCommon("1h 30m", Out, SParseLimits{5, 32}));
+    EXPECT_FALSE(TryParseCommon("1h 30m", Out, SParseLimits{256, 1}));
+    EXPECT_TRUE(TryParseCommon("1h", Out, SParseLimits{256, 1}));
+    EXPECT_EQ(Out, 1h);
+}
+
+TEST(CanonicalTest, TablesAreSmall) {
+    EXPECT_LE(sizeof(detail::CANONICAL_SEGMENTS), 1024u);
+    EXPECT_LE(sizeof(detail::COMMON_TABLE), 8192u);
+    EXPECT_LE(detail::COMMON_TABLE.m_MaxProbes, 8u);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <timeduration/timeduration.hpp>
+
+#include <string>
+
+using namespace timeduration;
+
+TEST(ComponentsTest, KeepsOriginalBreakdown) {
+    SParsedComponents Components;
+    ASSERT_TRUE(CTimePeriod::TryParseComponents("90m 2h 30 1y 2mo 3d 4s 5s", Components));
+    EXPECT_EQ(Components[UNIT_SECONDS], 9);
+    EXPECT_EQ(Components[UNIT_MINUTES], 120);
+    EXPECT_EQ(Components[UNIT_HOURS], 2);
+    EXPECT_EQ(Components[UNIT_DAYS], 3);
+    EXPECT_EQ(Components[UNIT_MONTHS], 2);
+    EXPECT_EQ(Components[UNIT_YEARS], 1);
+    EXPECT_FALSE(Components.isNormalized());
+    EXPECT_EQ(Components.duration(), CTimePeriod::Parse("90m 2h 30 1y 2mo 3d 4s 5s"));
+}
+
+TEST(ComponentsTest, IgnoresUnknownUnits) {
+    SParsedComponents Components;
+    ASSERT_TRUE(CTimePeriod::TryParseComponents("5x 3weeks 7s", Components));
+    EXPECT_EQ(Components.duration().count(), 7);
+    EXPECT_EQ(Components[UNIT_SECONDS], 7);
+}
+
+TEST(ComponentsTest, SameFailuresAsTryParse) {
+    SParsedComponents Components;
+    std::chrono::seconds Value{0};
+    for (const std::string Input: {"9223372036854775807s 1s", "106751991167301d", "99999999999999999999s",
+                                   "292471208678y", "153722867280912930m 1"}) {
+        EXPECT_FALSE(CTimePeriod::TryParse(Input, Value)) << Input;
+        EXPECT_FALSE(CTimePeriod::TryParseComponents(Input, Components)) << Input;
+    }
+    EXPECT_TRUE(CTimePeriod::TryParseComponents("9223372036854775807s", Components));
+    EXPECT_EQ(Components.duration().count(), 9223372036854775807);
+
+    EXPECT_FALSE(CTimePeriod::TryParseComponents("1s 2s 3s", Components, SParseLimits{100, 2}));
+    EXPECT_FALSE(CTimePeriod::TryParseComponents(std::string(300, '1'), Components, UNTRUSTED_INPUT_LIMITS));
+}
+
+TEST(ComponentsTest, NormalizedComponentsConstructDirectly) {
+    SParsedComponents Components;
+    ASSERT_TRUE(CTimePeriod::TryParseComponents("2d 5h 30m 15s", Components));
+    EXPECT_TRUE(Components.isNormalized());
+
+    const CTimePeriod Period(Components);
+    EXPECT_EQ(Period, CTimePeriod("2d 5h 30m 15s"));
+    EXPECT_EQ(Period.days(), 2);
+    EXPECT_EQ(Period.hours(), 5);
+    EXPECT_EQ(Period.minutes(), 30);
+    EXPECT_EQ(Period.seconds(), 15);
+}
+
+TEST(ComponentsTest, OtherComponentsAreNormalized) {
+    for (const char *pInput: {"90m", "25h", "61s", "1mo", "1y 1s", "3600s 2d", "0s", ""}) {
+        SParsedComponents Components;
+        ASSERT_TRUE(CTimePeriod::TryParseComponents(pInput, Components)) << pInput;
+        const CTimePeriod Period(Components);
+        const CTimePeriod Expected(pInput);
+        EXPECT_EQ(Period, Expected) << pInput;
+        EXPECT_EQ(Period.days(), Expected.days()) << pInput;
+        EXPECT_EQ(Period.hours(), Expected.hours()) << pInput;
+        EXPECT_EQ(Period.minutes(), Expected.minutes()) << pInput;
+        EXPECT_EQ(Period.seconds(), Expected.seconds()) << pInput;
+    }
+
+    // Hand-built negative slots are never taken over as they are
+    SParsedComponents Negative;
+    Negative[UNIT_HOURS] = 1;
+    Negative[UNIT_SECONDS] = -1;
+    EXPECT_FALSE(Negative.isNormalized());
+    EXPECT_EQ(CTimePeriod(Negative).duration().count(), 3599);
+    EXPECT_EQ(CTimePeriod(Negative).minutes(), 59);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <timeduration/config.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    constexpr std::string_view CONFIG = "# timeouts\n"
+                                        "connect = 30s\n"
+                                        "\n"
+                                        "session=2h 30m\r\n"
+                                        "; legacy\n"
+                                        "retention = P7D\n"
+                                        "not a setting\n"
+                                        "broken = P1Q\n"
+                                        "idle=15";
+
+    std::map<std::string, int64_t> Collect(CGenerator<SConfigEntry> Entries) {
+        std::map<std::string, int64_t> Result;
+        for (const auto &Entry: Entries)
+            Result[std::string(Entry.m_Key)] = Entry.m_Valid ? Entry.m_Value.duration().count() : -1;
+        return Result;
+    }
+
+    std::map<std::string, int64_t> ParseInChunks(const std::string_view Text, const size_t ChunkSize) {
+        CConfigParser Parser;
+        std::map<std::string, int64_t> Result;
+        for (size_t Offset = 0; Offset < Text.size(); Offset += ChunkSize)
+            Result.merge(Collect(Parser.Feed(Text.substr(Offset, ChunkSize))));
+        Result.merge(Collect(Parser.Finish()));
+        return Result;
+    }
+
+    struct SRecordedChange {
+        std::string m_Key;
+        EConfigChange m_Kind;
+        int64_t m_Seconds;
+
+        bool operator==(const SRecordedChange &) const = default;
+    };
+
+    std::vector<SRecordedChange> Reload(CConfigDiff &Diff, const std::string_view Text) {
+        std::vector<SRecordedChange> Changes;
+        const auto Record = [&](CGenerator<SConfigChange> Generator) {
+            for (const auto &Change: Generator)
+                Changes.push_back({std::string(Change.m_Key), Change.m_Kind, Change.m_Value.duration().count()});
+        };
+        Record(Diff.Feed(Text));
+        Record(Diff.Finish());
+        return Changes;
+    }
+}
+
+TEST(ConfigTest, ParsesWholeBuffer) {
+    const std::map<std::string, int64_t> Expected{
+        {"connect", 30}, {"session", 9000}, {"retention", 604800}, {"broken", -1}, {"idle", 900}};
+    EXPECT_EQ(ParseInChunks(CONFIG, CONFIG.size()), Expected);
+}
+
+TEST(ConfigTest, ChunkBoundariesDoNotMatter) {
+    const auto Expected = ParseInChunks(CONFIG, CONFIG.size());
+    for (size_t ChunkSize = 1; ChunkSize < CONFIG.size(); ++ChunkSize)
+        EXPECT_EQ(ParseInChunks(CONFIG, ChunkSize), Expected) << "chunk size " << ChunkSize;
+}
+
+TEST(ConfigTest, YieldsEntriesAsLinesComplete) {
+    CConfigParser Parser;
+    EXPECT_TRUE(Collect(Parser.Feed("a = 1h\nb = 2")).size() == 1);
+    const auto Rest = Collect(Parser.Feed("h\n"));
+    ASSERT_EQ(Rest.size(), 1u);
+    EXPECT_EQ(Rest.at("b"), 7200);
+    EXPECT_TRUE(Collect(Parser.Finish()).empty());
+}
+
+TEST(ConfigTest, DiffReportsOnlyChangedValues) {
+    CConfigDiff Diff;
+    EXPECT_EQ(Reload(Diff, "a = 1h\nb = 2h\nc = 3h\n"),
+              (std::vector<SRecordedChange>{{"a", EConfigChange::ADDED, 3600},
+                                            {"b", EConfigChange::ADDED, 7200},
+                                            {"c", EConfigChange::ADDED, 10800}}));
+    EXPECT_EQ(Diff.parsedCount(), 3u);
+
+    EXPECT_EQ(Reload(Diff, "a = 1h\nb = 90m\nd = 1s\n"),
+              (std::vector<SRecordedChange>{{"b", EConfigChange::CHANGED, 5400},
+                                            {"d", EConfigChange::ADDED, 1},
+                                            {"c", EConfigChange::REMOVED, 10800}}));
+    EXPECT_EQ(Diff.parsedCount(), 5u);
+    EXPECT_EQ(Diff.reusedCount(), 1u);
+    EXPECT_EQ(Diff.size(), 3u);
+    ASSERT_NE(Diff.Find("b"), nullptr);
+    EXPECT_EQ(Diff.Find("b")->duration().count(), 5400);
+    EXPECT_EQ(Diff.Find("c"), nullptr);
+}
+
+TEST(ConfigTest, DiffIgnoresReformattedLayout) {
+    CConfigDiff Diff;
+    (void)Reload(Diff, "a = 1h\nb = 2h");
+    // Whitespace around keys and values does not count as a change
+    EXPECT_TRUE(Reload(Diff, "  a=1h  \r\n\n# comment\nb   =   2h\n").empty());
+    EXPECT_EQ(Diff.parsedCount(), 2u);
+    EXPECT_EQ(Diff.reusedCount(), 2u);
+}
+
+TEST(ConfigTest, DiffKeepsInvalidValues) {
+    CConfigDiff Diff;
+    const auto Changes = Reload(Diff, "a = P1Q\n");
+    ASSERT_EQ(Changes.size(), 1u);
+    EXPECT_EQ(Diff.size(), 1u);
+    EXPECT_EQ(Diff.Find("a"), nullptr);
+    EXPECT_TRUE(Reload(Diff, "a = P1Q\n").empty());
+}
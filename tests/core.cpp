@@ -0,0 +1,39 @@
+// Only the value-type header: everything used here must work without parse.hpp / format.hpp
+#include <gtest/gtest.h>
+#include <timeduration/core.hpp>
+
+#include <type_traits>
+
+using namespace timeduration;
+
+static_assert(std::is_trivially_copyable_v<CTimePeriod>);
+
+TEST(CoreTest, ConstructsFromComponents) {
+    const CTimePeriod Period(15, 30, 5, 2);
+    EXPECT_EQ(Period.duration(), std::chrono::seconds(2 * 86400 + 5 * 3600 + 30 * 60 + 15));
+    EXPECT_EQ(Period.days(), 2);
+    EXPECT_EQ(Period.hours(), 5);
+    EXPECT_EQ(Period.minutes(), 30);
+    EXPECT_EQ(Period.seconds(), 15);
+}
+
+TEST(CoreTest, ComparesWithoutParsing) {
+    const CTimePeriod Short(std::chrono::seconds(90));
+    const CTimePeriod Long(0, 0, 1);
+    EXPECT_LT(Short, Long);
+    EXPECT_EQ(Short, CTimePeriod(30, 1));
+    EXPECT_TRUE(CTimePeriod().isZero());
+}
+
+TEST(CoreTest, ConstructsFromParsedComponents) {
+    SParsedComponents Components;
+    Components[UNIT_DAYS] = 1;
+    Components[UNIT_MINUTES] = 75;
+    static_assert(std::is_trivially_copyable_v<SParsedComponents>);
+    EXPECT_EQ(Components.duration().count(), 86400 + 75 * 60);
+
+    const CTimePeriod Period(Components);
+    EXPECT_EQ(Period.days(), 1);
+    EXPECT_EQ(Period.hours(), 1);
+    EXPECT_EQ(Period.minutes(), 15);
+}
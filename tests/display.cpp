@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <timeduration/display.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <array>
+#include <chrono>
+#include <memory_resource>
+#include <string>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    std::string Display(const std::chrono::seconds Duration, const SDisplayOptions &Options = SDisplayOptions()) {
+        char Buffer[DISPLAY_MAX_LENGTH];
+        return {Buffer, FormatDisplay(Duration, Buffer, Options)};
+    }
+
+    constexpr std::chrono::seconds SAMPLE = 2 * 86400s + 5h + 30min + 15s;
+}
+
+TEST(DisplayTest, CompactMatchesToString) {
+    for (const auto Duration: {0s, 1s, 59s, 60s, 3600s, 86399s, 86400s, SAMPLE, 400 * 86400s + 1s})
+        EXPECT_EQ(Display(Duration), CTimePeriod(Duration).toString()) << Duration.count();
+}
+
+TEST(DisplayTest, LongForm) {
+    const SDisplayOptions Long{EDisplayStyle::LONG};
+    EXPECT_EQ(Display(SAMPLE, Long), "2 days 5 hours 30 minutes 15 seconds");
+    EXPECT_EQ(Display(86400s + 1h + 1min + 1s, Long), "1 day 1 hour 1 minute 1 second");
+    EXPECT_EQ(Display(0s, Long), "0 seconds");
+    EXPECT_EQ(Display(-90s, Long), "-1 minute 30 seconds");
+}
+
+TEST(DisplayTest, RoundsToLargestUnits) {
+    EXPECT_EQ(Display(SAMPLE, {EDisplayStyle::COMPACT, 2}), "~2d 6h");
+    EXPECT_EQ(Display(SAMPLE, {EDisplayStyle::COMPACT, 1}), "~2d");
+    EXPECT_EQ(Display(SAMPLE, {EDisplayStyle::LONG, 2}), "~2 days 6 hours");
+    EXPECT_EQ(Display(SAMPLE, {EDisplayStyle::COMPACT, 4}), "2d 5h 30m 15s");
+
+    // Exact results and carries into a larger unit
+    EXPECT_EQ(Display(2h, {EDisplayStyle::COMPACT, 1}), "2h");
+    EXPECT_EQ(Display(2h + 5s, {EDisplayStyle::COMPACT, 2}), "~2h");
+    EXPECT_EQ(Display(23h + 59min + 40s, {EDisplayStyle::COMPACT, 2}), "~1d");
+    EXPECT_EQ(Display(59min + 29s, {EDisplayStyle::COMPACT, 1}), "~59m");
+    EXPECT_EQ(Display(59min + 30s, {EDisplayStyle::COMPACT, 1}), "~1h");
+    EXPECT_EQ(Display(-(59min + 30s), {EDisplayStyle::COMPACT, 1}), "~-1h");
+    EXPECT_EQ(Display(0s, {EDisplayStyle::COMPACT, 1}), "0s");
+}
+
+TEST(DisplayTest, ClockForm) {
+    const SDisplayOptions Clock{EDisplayStyle::CLOCK};
+    EXPECT_EQ(Display(SAMPLE, Clock), "53:30:15");
+    EXPECT_EQ(Display(0s, Clock), "0:00:00");
+    EXPECT_EQ(Display(3723s, Clock), "1:02:03");
+    EXPECT_EQ(Display(-3723s, Clock), "-1:02:03");
+    EXPECT_EQ(Display(1000h, Clock), "1000:00:00");
+}
+
+TEST(DisplayTest, CalendarUnitsRoundTripThroughParse) {
+    const SDisplayOptions Calendar{EDisplayStyle::COMPACT, 0, true};
+    const auto Duration = CTimePeriod::Parse("1y 2mo 3d 4h 5m 6s");
+    EXPECT_EQ(Display(Duration, Calendar), "1y 2mo 3d 4h 5m 6s");
+    EXPECT_EQ(CTimePeriod::Parse(Display(Duration, Calendar)), Duration);
+    EXPECT_EQ(Display(Duration, {EDisplayStyle::LONG, 2, true}), "~1 year 2 months");
+    EXPECT_EQ(Display(364 * 86400s, Calendar), "13mo");
+    EXPECT_EQ(Display(364 * 86400s + 23h + 59min + 59s, {EDisplayStyle::COMPACT, 2, true}), "~1y");
+
+    // Without calendar units the largest unit is days
+    EXPECT_EQ(Display(Duration), "424d 4h 5m 6s");
+}
+
+TEST(DisplayTest, ExtremesFitTheMaximumLength) {
+    for (const auto Style: {EDisplayStyle::COMPACT, EDisplayStyle::LONG, EDisplayStyle::CLOCK}) {
+        for (const bool CalendarUnits: {false, true}) {
+            for (const auto Duration: {std::chrono::seconds::min(), std::chrono::seconds::max(),
+                                       std::chrono::seconds::min() + 1s}) {
+                const std::string Text = Display(Duration, {Style, 0, CalendarUnits});
+                EXPECT_FALSE(Text.empty());
+                EXPECT_LE(Text.size(), DISPLAY_MAX_LENGTH);
+            }
+        }
+    }
+    EXPECT_EQ(Display(std::chrono::seconds::min(), {EDisplayStyle::LONG, 0, true}),
+              "-292471208677 years 6 months 27 days 15 hours 30 minutes 8 seconds");
+    EXPECT_EQ(Display(std::chrono::seconds::max(), {EDisplayStyle::CLOCK}), "2562047788015215:30:07");
+}
+
+TEST(DisplayTest, RejectsShortBuffers) {
+    std::array<char, 5> Buffer{};
+    EXPECT_EQ(FormatDisplay(SAMPLE, Buffer), 0u);
+    EXPECT_EQ(FormatDisplay(59s, Buffer), 3u);
+    EXPECT_EQ(std::string(Buffer.data(), 3), "59s");
+}
+
+TEST(DisplayTest, ToDisplayString) {
+    EXPECT_EQ(ToDisplayString(CTimePeriod("2d 5h 30m 15s"), {EDisplayStyle::LONG, 2}), "~2 days 6 hours");
+
+    std::array<std::byte, 256> aStorage;
+    std::pmr::monotonic_buffer_resource Resource(aStorage.data(), aStorage.size(), std::pmr::null_memory_resource());
+    const std::pmr::string Text = ToDisplayString(CTimePeriod(SAMPLE), {EDisplayStyle::LONG}, &Resource);
+    EXPECT_EQ(Text, "2 days 5 hours 30 minutes 15 seconds");
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <timeduration/expression.hpp>
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+TEST(ExpressionTest, EvaluatesArithmetic) {
+    EXPECT_EQ(CExpression::Compile("2h - 15m").Evaluate(), 6300s);
+    EXPECT_EQ(CExpression::Compile("3 * 10m").Evaluate(), 1800s);
+    EXPECT_EQ(CExpression::Compile("10m * 3").Evaluate(), 1800s);
+    EXPECT_EQ(CExpression::Compile("1h / 4").Evaluate(), 900s);
+    EXPECT_EQ(CExpression::Compile("1h 30m + 2 * (5m - 30s)").Evaluate(), 5940s);
+    EXPECT_EQ(CExpression::Compile("-1h + 90m").Evaluate(), 1800s);
+    EXPECT_EQ(CExpression::Compile("1d - 1y").Evaluate(), -364 * 86400s);
+    EXPECT_EQ(CExpression::Compile("1mo").Evaluate(), 28 * 86400s);
+}
+
+TEST(ExpressionTest, LiteralsFollowTheNativeGrammar) {
+    // Adjacent terms form one literal and bare numbers used as durations are minutes
+    EXPECT_EQ(CExpression::Compile("1h30m").Evaluate(), CTimePeriod("1h30m").duration());
+    EXPECT_EQ(CExpression::Compile("1hours 2minutes 3seconds").Evaluate(), 3723s);
+    EXPECT_EQ(CExpression::Compile("90").Evaluate(), 5400s);
+    EXPECT_EQ(CExpression::Compile("1h + 30").Evaluate(), 5400s);
+    EXPECT_EQ(CExpression::Compile("2 * 3").Evaluate(), 360s);
+    EXPECT_EQ(CExpression::Compile("1h + 10 / 4").Evaluate(), 3720s);
+}
+
+TEST(ExpressionTest, MinAndMax) {
+    EXPECT_EQ(CExpression::Compile("min(1h, 45m)").Evaluate(), 2700s);
+    EXPECT_EQ(CExpression::Compile("max(1h, 45m, 2h - 1s)").Evaluate(), 7199s);
+    EXPECT_EQ(CExpression::Compile("min(3, 2) * 1m").Evaluate(), 120s);
+    EXPECT_EQ(CExpression::Compile("max(-5m, 0s)").Evaluate(), 0s);
+}
+
+TEST(ExpressionTest, BindsVariables) {
+    const CExpression Expression = CExpression::Compile("max(base / 2, 5m) + jitter - base * 0");
+    ASSERT_EQ(Expression.Variables().size(), 2u);
+    EXPECT_EQ(Expression.Variables()[0], "base");
+    EXPECT_EQ(Expression.Variables()[1], "jitter");
+
+    const std::array<std::chrono::seconds, 2> Small{1min, 10s};
+    const std::array<std::chrono::seconds, 2> Large{1h, 10s};
+    EXPECT_EQ(Expression.Evaluate(Small), 310s);
+    EXPECT_EQ(Expression.Evaluate(Large), 1810s);
+
+    std::chrono::seconds Out{0};
+    EXPECT_FALSE(Expression.TryEvaluate(Out, std::span(Small).first(1)));
+    EXPECT_THROW((void)Expression.Evaluate(), std::out_of_range);
+}
+
+TEST(ExpressionTest, FoldsConstants) {
+    EXPECT_EQ(CExpression::Compile("max(1h, 2 * 45m) - 15m + 3 * (1d / 4)").CodeSize(), 1u);
+    EXPECT_GT(CExpression::Compile("timeout - 15m").CodeSize(), 1u);
+}
+
+TEST(ExpressionTest, RejectsMalformedExpressions) {
+    for (const char *pSource: {"", "2h -", "(1h", "1h)", "1h * 2h", "2 / 1h", "1x", "1h $ 2",
+                               "min(1h)", "min 1h", "max(1h, 2)", "1h 30", "99999999999999999999s"}) {
+        EXPECT_THROW((void)CExpression::Compile(pSource), std::invalid_argument) << pSource;
+    }
+
+    try {
+        (void)CExpression::Compile("1h + 2q");
+        FAIL();
+    } catch (const std::invalid_argument &Error) {
+        EXPECT_NE(std::string(Error.what()).find("offset 6"), std::string::npos) << Error.what();
+    }
+}
+
+TEST(ExpressionTest, LimitsNestingAndStackDepth) {
+    EXPECT_THROW((void)CExpression::Compile(std::string(1000, '(') + "1h" + std::string(1000, ')')),
+                 std::invalid_argument);
+    EXPECT_THROW((void)CExpression::Compile(std::string(1000, '-') + "1h"), std::invalid_argument);
+
+    // Right-nested sums keep every left operand on the stack
+    std::string Deep = "1s";
+    for (int i = 0; i < 40; ++i)
+        Deep = "1s + (" + Deep + ")";
+    EXPECT_THROW((void)CExpression::Compile(Deep), std::invalid_argument);
+
+    // Left-nested ones do not
+    std::string Long = "1s";
+    for (int i = 0; i < 1000; ++i)
+        Long += " + 1s";
+    EXPECT_EQ(CExpression::Compile(Long).Evaluate(), 1001s);
+}
+
+TEST(ExpressionTest, ReportsArithmeticErrors) {
+    const CExpression Divide = CExpression::Compile("x / 0");
+    std::chrono::seconds Out{0};
+    const std::array<std::chrono::seconds, 1> Hour{1h};
+    EXPECT_FALSE(Divide.TryEvaluate(Out, Hour));
+
+    EXPECT_THROW((void)CExpression::Compile("100000000000y * 1000").Evaluate(), std::out_of_range);
+    EXPECT_THROW((void)CExpression::Compile("x - 1s").Evaluate(std::array{std::chrono::seconds::min()}),
+                 std::out_of_range);
+    EXPECT_THROW((void)CExpression::Compile("-x").Evaluate(std::array{std::chrono::seconds::min()}),
+                 std::out_of_range);
+    EXPECT_THROW((void)CExpression::Compile("x / -1").Evaluate(std::array{std::chrono::seconds::min()}),
+                 std::out_of_range);
+}
+
+TEST(ExpressionTest, CacheCompilesOnce) {
+    CExpressionCache Cache;
+    const auto pFirst = Cache.Get("2h - 15m");
+    const auto pSecond = Cache.Get(std::string("2h - 15m"));
+    EXPECT_EQ(pFirst, pSecond);
+    EXPECT_EQ(pFirst->Evaluate(), 6300s);
+    EXPECT_EQ(Cache.size(), 1u);
+
+    EXPECT_THROW((void)Cache.Get("2h -"), std::invalid_argument);
+    EXPECT_EQ(Cache.size(), 1u);
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.size(), 0u);
+    EXPECT_NE(Cache.Get("2h - 15m"), pFirst);
+}
+
+TEST(ExpressionTest, CacheIsThreadSafe) {
+    CExpressionCache Cache;
+    std::vector<std::thread> vThreads;
+    for (int t = 0; t < 4; ++t) {
+        vThreads.emplace_back([&Cache] {
+            for (int i = 0; i < 1000; ++i)
+                EXPECT_EQ(Cache.Get(std::to_string(i % 16) + "m + 1s")->Evaluate(), std::chrono::seconds(60 * (i % 16) + 1));
+        });
+    }
+    for (auto &Thread: vThreads)
+        Thread.join();
+    EXPECT_EQ(Cache.size(), 16u);
+}
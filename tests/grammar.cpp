@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <timeduration/grammar.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    struct SCase {
+        std::string_view m_Input;
+        std::chrono::nanoseconds m_Expected;
+    };
+}
+
+// Expected values are the outputs of Go's time.ParseDuration
+TEST(GoGrammarTest, MatchesGoParseDuration) {
+    const std::vector<SCase> Cases = {
+        {"0", 0ns}, {"5s", 5s}, {"30s", 30s}, {"1478s", 1478s},
+        {"-5s", -5s}, {"+5s", 5s}, {"-0", 0ns}, {"+0", 0ns},
+        {"5.0s", 5s}, {"5.6s", 5s + 600ms}, {"5.s", 5s}, {".5s", 500ms},
+        {"1.0s", 1s}, {"1.00s", 1s}, {"1.004s", 1s + 4ms}, {"1.0040s", 1s + 4ms},
+        {"100.00100s", 100s + 1ms},
+        {"10ns", 10ns}, {"11us", 11us}, {"12\xC2\xB5s", 12us}, {"12\xCE\xBCs", 12us},
+        {"13ms", 13ms}, {"14s", 14s}, {"15m", 15min}, {"16h", 16h},
+        {"3h30m", 3h + 30min}, {"10.5s4m", 4min + 10s + 500ms}, {"-2m3.4s", -(2min + 3s + 400ms)},
+        {"1h2m3s4ms5us6ns", 1h + 2min + 3s + 4ms + 5us + 6ns},
+        {"39h9m14.425s", 39h + 9min + 14s + 425ms},
+        {"52763797000ns", 52763797000ns},
+        {"1.5h", 90min}, {"250ms", 250ms}, {"-5m", -5min},
+        {"0.100000000000000000000h", 6min},
+        {"9007199254740993ns", std::chrono::nanoseconds((int64_t{1} << 53) + 1)},
+        {"9223372036854775807ns", std::chrono::nanoseconds::max()},
+        {"9223372036854775.807us", std::chrono::nanoseconds::max()},
+        {"9223372036s854ms775us807ns", std::chrono::nanoseconds::max()},
+        {"-9223372036854775808ns", std::chrono::nanoseconds::min()},
+        {"-9223372036854775.808us", std::chrono::nanoseconds::min()},
+        {"-9223372036s854ms775us808ns", std::chrono::nanoseconds::min()},
+        {"-2562047h47m16.854775808s", std::chrono::nanoseconds::min()},
+    };
+
+    for (const auto &Case: Cases) {
+        std::chrono::nanoseconds Out{-1};
+        ASSERT_TRUE(ParseWithGrammar<CGoGrammar>(Case.m_Input, Out)) << "Input: " << Case.m_Input;
+        EXPECT_EQ(Out, Case.m_Expected) << "Input: " << Case.m_Input;
+    }
+}
+
+TEST(GoGrammarTest, RejectsWhatGoRejects) {
+    for (const std::string_view Input: {"", "3", "-", "s", ".", "-.", ".s", "+.s", "1d", "1h 30m",
+                                        "\x85\x85", "\xff\xff", "hello \xff\xff world",
+                                        "9223372036854775808ns", "9223372036854775.808us",
+                                        "9223372036854ms775us808ns", "-9223372036854775809ns"}) {
+        std::chrono::nanoseconds Out{0};
+        EXPECT_FALSE(ParseWithGrammar<CGoGrammar>(Input, Out)) << "Input: " << Input;
+    }
+}
+
+TEST(GoGrammarTest, FractionsAreExact) {
+    // Go rounds through float64 and returns exactly 20m here
+    std::chrono::nanoseconds Out{0};
+    ASSERT_TRUE(ParseWithGrammar<CGoGrammar>("0.3333333333333333333h", Out));
+    EXPECT_EQ(Out, 20min - 1ns);
+}
+
+TEST(PrometheusGrammarTest, ParsesRanges) {
+    const std::vector<std::pair<std::string_view, std::chrono::milliseconds>> Cases = {
+        {"0", 0ms}, {"5m", 5min}, {"1h30m", 90min}, {"250ms", 250ms}, {"2w", std::chrono::hours(24 * 14)},
+        {"1y", std::chrono::hours(24 * 365)}, {"1d12h", 36h}, {"1m30s500ms", 90s + 500ms},
+    };
+
+    for (const auto &[Input, Expected]: Cases) {
+        std::chrono::milliseconds Out{-1};
+        ASSERT_TRUE(ParseWithGrammar<CPrometheusGrammar>(Input, Out)) << "Input: " << Input;
+        EXPECT_EQ(Out, Expected) << "Input: " << Input;
+    }
+}
+
+TEST(PrometheusGrammarTest, RejectsOutOfOrderAndExtendedSyntax) {
+    for (const std::string_view Input: {"", "5", "30m1h", "1h1h", "1.5h", "-5m", "5ns", "1h 30m"}) {
+        std::chrono::milliseconds Out{0};
+        EXPECT_FALSE(ParseWithGrammar<CPrometheusGrammar>(Input, Out)) << "Input: " << Input;
+    }
+}
+
+TEST(NativeGrammarTest, DefaultGrammarIsTryParse) {
+    std::chrono::seconds Out{0};
+    ASSERT_TRUE(ParseWithGrammar("1h 90 30s", Out));
+    EXPECT_EQ(Out, CTimePeriod::Parse("1h 90 30s"));
+}
+
+TEST(GrammarTest, ParsesIntoTimePeriod) {
+    CTimePeriod Period;
+    ASSERT_TRUE(ParseWithGrammar<CGoGrammar>("1h30m15.9s", Period));
+    EXPECT_EQ(Period.hours(), 1);
+    EXPECT_EQ(Period.minutes(), 30);
+    EXPECT_EQ(Period.seconds(), 15);
+
+    ASSERT_TRUE(ParseWithGrammar<CPrometheusGrammar>("1d2h", Period));
+    EXPECT_EQ(Period.days(), 1);
+    EXPECT_EQ(Period.hours(), 2);
+
+    EXPECT_FALSE(ParseWithGrammar<CGoGrammar>("1d", Period));
+}
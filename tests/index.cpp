@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <timeduration/index.hpp>
+
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    using Reference = std::multimap<int64_t, int>;
+
+    size_t ReferenceCount(const Reference &Map, const int64_t From, const int64_t To) {
+        if (From >= To)
+            return 0;
+        return static_cast<size_t>(std::distance(Map.lower_bound(From), Map.lower_bound(To)));
+    }
+
+    std::vector<std::pair<int64_t, int>> Collect(const CDurationIndex<int> &Index, const int64_t From, const int64_t To) {
+        std::vector<std::pair<int64_t, int>> Result;
+        Index.ForEachInRange(std::chrono::seconds(From), std::chrono::seconds(To),
+                             [&Result](const std::chrono::seconds Key, const int &Value) { Result.emplace_back(Key.count(), Value); });
+        return Result;
+    }
+
+    std::vector<std::pair<int64_t, int>> Collect(const Reference &Map, const int64_t From, const int64_t To) {
+        std::vector<std::pair<int64_t, int>> Result;
+        if (From < To)
+            Result.assign(Map.lower_bound(From), Map.lower_bound(To));
+        return Result;
+    }
+}
+
+TEST(IndexTest, EmptyIndex) {
+    const CDurationIndex<int> Index;
+    EXPECT_TRUE(Index.empty());
+    EXPECT_EQ(Index.CountInRange(0s, 1h), 0u);
+    EXPECT_TRUE(Collect(Index, -100, 100).empty());
+}
+
+TEST(IndexTest, CountsAndIteratesCTimePeriodRanges) {
+    CDurationIndex<int> Index({{CTimePeriod("30m").duration(), 1}, {CTimePeriod("5m").duration(), 2},
+                               {CTimePeriod("1h").duration(), 3}, {CTimePeriod("4m").duration(), 4}});
+    Index.Insert(CTimePeriod("10m"), 5);
+    EXPECT_EQ(Index.size(), 5u);
+
+    // [5m, 1h)
+    EXPECT_EQ(Index.CountInRange(CTimePeriod("5m"), CTimePeriod("1h")), 3u);
+    std::vector<int> vValues;
+    Index.ForEachInRange(CTimePeriod("5m"), CTimePeriod("1h"),
+                         [&vValues](std::chrono::seconds, const int Value) { vValues.push_back(Value); });
+    EXPECT_EQ(vValues, (std::vector<int>{2, 5, 1}));
+
+    EXPECT_EQ(Index.CountInRange(1h, 300s), 0u);
+    EXPECT_EQ(Index.CountInRange(300s, 300s), 0u);
+}
+
+TEST(IndexTest, DuplicatesKeepInsertionOrder) {
+    CDurationIndex<int> Index({{10s, 0}, {10s, 1}, {5s, 2}, {10s, 3}});
+    Index.Insert(10s, 4);
+    Index.Insert(10s, 5);
+    EXPECT_EQ(Collect(Index, 10, 11), (std::vector<std::pair<int64_t, int>>{{10, 0}, {10, 1}, {10, 3}, {10, 4}, {10, 5}}));
+    Index.Compact();
+    EXPECT_EQ(Collect(Index, 10, 11), (std::vector<std::pair<int64_t, int>>{{10, 0}, {10, 1}, {10, 3}, {10, 4}, {10, 5}}));
+}
+
+TEST(IndexTest, MatchesMultimap) {
+    std::mt19937_64 Rng(7);
+    std::uniform_int_distribution<int64_t> Keys(-5000, 5000);
+
+    for (const size_t Size: {size_t{1}, size_t{15}, size_t{16}, size_t{17}, size_t{255}, size_t{1000}, size_t{20000}}) {
+        std::vector<CDurationIndex<int>::Entry> vEntries;
+        Reference Map;
+        for (size_t i = 0; i < Size; ++i) {
+            const int64_t Key = Keys(Rng);
+            vEntries.emplace_back(std::chrono::seconds(Key), static_cast<int>(i));
+            Map.emplace(Key, static_cast<int>(i));
+        }
+        CDurationIndex<int> Index(vEntries);
+
+        // Interleave inserts (crossing several compactions) with queries
+        for (int Round = 0; Round < 2000; ++Round) {
+            if (Round % 2 == 0) {
+                const int64_t Key = Keys(Rng);
+                Index.Insert(std::chrono::seconds(Key), Round + 1000000);
+                Map.emplace(Key, Round + 1000000);
+            }
+            const int64_t From = Keys(Rng) - 100;
+            const int64_t To = From + Keys(Rng) % 3000;
+            ASSERT_EQ(Index.CountInRange(std::chrono::seconds(From), std::chrono::seconds(To)), ReferenceCount(Map, From, To))
+                << Size << " [" << From << ", " << To << ")";
+            if (Round % 50 == 0) {
+                ASSERT_EQ(Collect(Index, From, To), Collect(Map, From, To));
+            }
+        }
+        EXPECT_EQ(Index.size(), Map.size());
+        EXPECT_EQ(Index.CountInRange(std::chrono::seconds(INT64_MIN), std::chrono::seconds(INT64_MAX)), Map.size());
+        EXPECT_EQ(Collect(Index, INT64_MIN, INT64_MAX), Collect(Map, INT64_MIN, INT64_MAX));
+    }
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <timeduration/timeduration.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+using namespace timeduration;
+
+static_assert(instrumentation::ENABLED, "Build this test with TIMEDURATION_ENABLE_INSTRUMENTATION");
+
+namespace {
+    uint64_t g_FakeTime = 0;
+
+    uint64_t FakeClock() noexcept {
+        return g_FakeTime += 100;
+    }
+}
+
+class InstrumentationTest : public ::testing::Test {
+protected:
+    instrumentation::SSnapshot m_Before;
+
+    void SetUp() override {
+        instrumentation::SetSampleInterval(0);
+        m_Before = instrumentation::Snapshot();
+    }
+
+    void TearDown() override {
+        instrumentation::SetClock(nullptr);
+        instrumentation::SetSampleInterval(64);
+    }
+};
+
+TEST_F(InstrumentationTest, CountsParsesTokensAndBytes) {
+    std::chrono::seconds Out{0};
+    (void)CTimePeriod::Parse("2h 30m 15s");
+    ASSERT_TRUE(CTimePeriod::TryParse("1d 5x 10", Out));
+
+    const auto After = instrumentation::Snapshot();
+    EXPECT_EQ(After.m_Parses - m_Before.m_Parses, 2);
+    EXPECT_EQ(After.m_Tokens - m_Before.m_Tokens, 6);
+    EXPECT_EQ(After.m_UnknownUnits - m_Before.m_UnknownUnits, 1);
+    EXPECT_EQ(After.m_BytesScanned - m_Before.m_BytesScanned, 10 + 8);
+    EXPECT_EQ(After.m_SampledParses - m_Before.m_SampledParses, 0);
+}
+
+TEST_F(InstrumentationTest, CountsOverflows) {
+    std::chrono::seconds Out{0};
+    EXPECT_FALSE(CTimePeriod::TryParse("99999999999999999999s", Out));
+    EXPECT_THROW((void)CTimePeriod::Parse("99999999999999999999s"), std::out_of_range);
+
+    const auto After = instrumentation::Snapshot();
+    EXPECT_EQ(After.m_Overflows - m_Before.m_Overflows, 2);
+}
+
+TEST_F(InstrumentationTest, ConstructorCountsRejectedInputOnce) {
+    EXPECT_THROW(CTimePeriod("9999999999999999y"), std::out_of_range);
+    EXPECT_THROW(CTimePeriod("99999999999999999999s"), std::out_of_range);
+    EXPECT_EQ(CTimePeriod("1h 5x").duration(), std::chrono::hours(1));
+
+    const auto After = instrumentation::Snapshot();
+    EXPECT_EQ(After.m_Parses - m_Before.m_Parses, 3);
+    EXPECT_EQ(After.m_Overflows - m_Before.m_Overflows, 2);
+    EXPECT_EQ(After.m_UnknownUnits - m_Before.m_UnknownUnits, 1);
+    EXPECT_EQ(After.m_BytesScanned - m_Before.m_BytesScanned, 17 + 21 + 5);
+}
+
+TEST_F(InstrumentationTest, SamplesLatencyWithPluggableClock) {
+    instrumentation::SetClock(&FakeClock);
+    instrumentation::SetSampleInterval(1);
+
+    for (int i = 0; i < 3; ++i)
+        (void)CTimePeriod::Parse("5m");
+
+    const auto After = instrumentation::Snapshot();
+    EXPECT_EQ(After.m_SampledParses - m_Before.m_SampledParses, 3);
+    EXPECT_EQ(After.m_SampledNanoseconds - m_Before.m_SampledNanoseconds, 300);
+    EXPECT_GE(After.m_MaxSampledNanoseconds, 100);
+}
+
+TEST_F(InstrumentationTest, KeepsCountsOfExitedThreads) {
+    std::thread Worker([] {
+        for (int i = 0; i < 10; ++i)
+            (void)CTimePeriod::Parse("1h");
+    });
+    Worker.join();
+
+    const auto After = instrumentation::Snapshot();
+    EXPECT_EQ(After.m_Parses - m_Before.m_Parses, 10);
+    EXPECT_EQ(After.m_Tokens - m_Before.m_Tokens, 10);
+}
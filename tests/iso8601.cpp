@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <timeduration/iso8601.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    int64_t ParseOrFail(const std::string_view Source) {
+        std::chrono::seconds Out{-12345};
+        EXPECT_TRUE(ParseIso8601(Source, Out)) << "Input: " << Source;
+        return Out.count();
+    }
+
+    bool Rejects(const std::string_view Source) {
+        std::chrono::seconds Out{0};
+        return !ParseIso8601(Source, Out);
+    }
+}
+
+TEST(Iso8601Test, ParsesTimeComponents) {
+    EXPECT_EQ(ParseOrFail("PT2H30M15S"), 2 * 3600 + 30 * 60 + 15);
+    EXPECT_EQ(ParseOrFail("PT2H"), 7200);
+    EXPECT_EQ(ParseOrFail("PT90M"), 5400);
+    EXPECT_EQ(ParseOrFail("PT0S"), 0);
+}
+
+TEST(Iso8601Test, ParsesDateComponents) {
+    EXPECT_EQ(ParseOrFail("P1DT2H30M"), 86400 + 7200 + 1800);
+    EXPECT_EQ(ParseOrFail("P2W"), 2 * 604800);
+    // Same conventions as the native grammar: months are 28 days, years 365 days
+    EXPECT_EQ(ParseOrFail("P1M"), CTimePeriod::Parse("1mo").count());
+    EXPECT_EQ(ParseOrFail("P1Y"), CTimePeriod::Parse("1y").count());
+    EXPECT_EQ(ParseOrFail("P1Y2M3DT4H5M6S"), CTimePeriod::Parse("1y 2mo 3d 4h 5m 6s").count());
+}
+
+TEST(Iso8601Test, ParsesFractionsAndSigns) {
+    EXPECT_EQ(ParseOrFail("PT1.5H"), 5400);
+    EXPECT_EQ(ParseOrFail("PT0,5M"), 30);
+    EXPECT_EQ(ParseOrFail("PT15.999S"), 15);
+    EXPECT_EQ(ParseOrFail("-PT1M"), -60);
+    EXPECT_EQ(ParseOrFail("+PT1M"), 60);
+    EXPECT_EQ(ParseOrFail("pt1m"), 60);
+}
+
+TEST(Iso8601Test, RejectsMalformedInput) {
+    for (const auto *Input: {"", "P", "PT", "P1DT", "T1H", "1H", "PT1H2", "P1H", "PT1D",
+                             "PT1M1H", "P1D1Y", "PT1.5H30M", "PT1.H", "PT1HT1M", "P1D ", "PT-1S"}) {
+        EXPECT_TRUE(Rejects(Input)) << "Input: " << Input;
+    }
+}
+
+TEST(Iso8601Test, RejectsOverflow) {
+    EXPECT_TRUE(Rejects("PT9223372036854775808S"));
+    EXPECT_TRUE(Rejects("PT9223372036854775807H"));
+    EXPECT_TRUE(Rejects("P300000000000Y"));
+    EXPECT_EQ(ParseOrFail("PT9223372036854775807S"), std::numeric_limits<int64_t>::max());
+}
+
+TEST(Iso8601Test, FormatsDurations) {
+    EXPECT_EQ(ToIso8601(CTimePeriod("2h 30m 15s")), "PT2H30M15S");
+    EXPECT_EQ(ToIso8601(CTimePeriod("1d 2h 30m")), "P1DT2H30M");
+    EXPECT_EQ(ToIso8601(CTimePeriod("3d")), "P3D");
+    EXPECT_EQ(ToIso8601(CTimePeriod()), "PT0S");
+    EXPECT_EQ(ToIso8601(CTimePeriod(std::chrono::seconds(-61))), "-PT1M1S");
+}
+
+TEST(Iso8601Test, FormatRespectsBufferSize) {
+    char Small[4];
+    EXPECT_EQ(FormatIso8601(std::chrono::seconds(9015), Small), 0);
+
+    char Buffer[ISO8601_MAX_LENGTH];
+    const size_t Length = FormatIso8601(std::chrono::seconds(std::numeric_limits<int64_t>::min()), Buffer);
+    ASSERT_GT(Length, 0);
+    EXPECT_LE(Length, ISO8601_MAX_LENGTH);
+}
+
+TEST(Iso8601Test, RoundTrips) {
+    for (const int64_t Total: {int64_t{0}, int64_t{1}, int64_t{59}, int64_t{3600}, int64_t{86399},
+                               int64_t{86400}, int64_t{987654321}, int64_t{-5400}}) {
+        char Buffer[ISO8601_MAX_LENGTH];
+        const size_t Length = FormatIso8601(std::chrono::seconds(Total), Buffer);
+        EXPECT_EQ(ParseOrFail(std::string_view(Buffer, Length)), Total);
+    }
+}
+
+TEST(Iso8601Test, UnifiedEntryPointDetectsGrammar) {
+    std::chrono::seconds Out{0};
+    ASSERT_TRUE(TryParseDuration("PT2H", Out));
+    EXPECT_EQ(Out.count(), 7200);
+    ASSERT_TRUE(TryParseDuration("2h", Out));
+    EXPECT_EQ(Out.count(), 7200);
+    ASSERT_TRUE(TryParseDuration("1h 90 30s", Out));
+    EXPECT_EQ(Out.count(), CTimePeriod::Parse("1h 90 30s").count());
+    EXPECT_FALSE(TryParseDuration("P2H", Out));
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <timeduration/timeduration.hpp>
+
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+using namespace timeduration;
+
+TEST(LimitsTest, DefaultLimitsAreUnbounded) {
+    const std::string Input(100000, ' ');
+    std::chrono::seconds Value{1};
+    EXPECT_TRUE(CTimePeriod::TryParse(Input + "5s", Value, SParseLimits()));
+    EXPECT_EQ(Value.count(), 5);
+    EXPECT_EQ(CTimePeriod::Parse(Input + "5s", SParseLimits()).count(), 5);
+}
+
+TEST(LimitsTest, RejectsLongInput) {
+    const SParseLimits Limits{8, 100};
+    std::chrono::seconds Value{0};
+    EXPECT_TRUE(CTimePeriod::TryParse("1h 30m", Value, Limits));
+    EXPECT_EQ(Value.count(), 5400);
+    EXPECT_TRUE(CTimePeriod::TryParse("12345678", Value, Limits));
+    EXPECT_FALSE(CTimePeriod::TryParse("123456789", Value, Limits));
+
+    EXPECT_EQ(CTimePeriod::Parse("1h 30m", Limits).count(), 5400);
+    EXPECT_THROW((void)CTimePeriod::Parse("123456789", Limits), std::length_error);
+    EXPECT_THROW(CScanner("123456789", DefaultTokens(), Limits), std::length_error);
+}
+
+TEST(LimitsTest, RejectsTooManyTokens) {
+    const SParseLimits Limits{1000, 3};
+    std::chrono::seconds Value{0};
+    EXPECT_TRUE(CTimePeriod::TryParse("1d 2h 3m", Value, Limits));
+    EXPECT_EQ(Value.count(), 86400 + 7200 + 180);
+    EXPECT_FALSE(CTimePeriod::TryParse("1d 2h 3m 4s", Value, Limits));
+    // Unknown units still count, their numbers were scanned
+    EXPECT_FALSE(CTimePeriod::TryParse("1x 2x 3x 4x", Value, Limits));
+
+    EXPECT_EQ(CTimePeriod::Parse("1d 2h 3m", Limits).count(), 86400 + 7200 + 180);
+    EXPECT_THROW((void)CTimePeriod::Parse("1d 2h 3m 4s", Limits), std::length_error);
+}
+
+TEST(LimitsTest, UntrustedPresetAcceptsTypicalInput) {
+    std::chrono::seconds Value{0};
+    EXPECT_TRUE(CTimePeriod::TryParse("1y 2mo 3d 4h 5m 6s", Value, UNTRUSTED_INPUT_LIMITS));
+    EXPECT_FALSE(CTimePeriod::TryParse(std::string(1 << 20, '9'), Value, UNTRUSTED_INPUT_LIMITS));
+}
+
+TEST(LimitsTest, LongDigitRunsFailWithoutScanningThemWhole) {
+    // Leading zeros do not count toward the 19 significant digits
+    EXPECT_EQ(CTimePeriod::Parse(std::string(1000, '0') + "7s").count(), 7);
+    EXPECT_EQ(CTimePeriod::Parse("0009223372036854775807s").count(), std::numeric_limits<int64_t>::max());
+    EXPECT_THROW((void)CTimePeriod::Parse("9223372036854775808s"), std::out_of_range);
+    EXPECT_THROW((void)CTimePeriod::Parse(std::string(10 << 20, '9')), std::out_of_range);
+}
+
+TEST(LimitsTest, TotalOverflowThrowsInsteadOfWrapping) {
+    // Short enough for the untrusted preset, but the seconds do not fit int64_t
+    for (const char *pSource: {"9999999999999999y", "9000000000000000000s 9000000000000000000s",
+                               "5000000000000000000s 5000000000000000000"}) {
+        std::chrono::seconds Value{0};
+        EXPECT_FALSE(CTimePeriod::TryParse(pSource, Value, UNTRUSTED_INPUT_LIMITS)) << pSource;
+        EXPECT_THROW((void)CTimePeriod::Parse(pSource, UNTRUSTED_INPUT_LIMITS), std::out_of_range) << pSource;
+        EXPECT_THROW((void)CTimePeriod::Parse(pSource), std::out_of_range) << pSource;
+        EXPECT_THROW(CTimePeriod{std::string_view(pSource)}, std::out_of_range) << pSource;
+    }
+    EXPECT_EQ(CTimePeriod::Parse("9223372036854775000s 807s").count(), std::numeric_limits<int64_t>::max());
+}
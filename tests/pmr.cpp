@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <timeduration/iso8601.hpp>
+#include <timeduration/timeduration.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+
+using namespace timeduration;
+
+// Count every global-heap allocation in this test binary (built on its own, see CMakeLists.txt) so arena tests can assert on it
+namespace {
+    std::atomic<size_t> g_GlobalAllocations{0};
+}
+
+void *operator new(const std::size_t Size) {
+    ++g_GlobalAllocations;
+    if (void *Ptr = std::malloc(Size ? Size : 1))
+        return Ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new(const std::size_t Size, const std::nothrow_t &) noexcept {
+    ++g_GlobalAllocations;
+    return std::malloc(Size ? Size : 1);
+}
+
+void operator delete(void *Ptr) noexcept {
+    std::free(Ptr);
+}
+
+void operator delete(void *Ptr, std::size_t) noexcept {
+    std::free(Ptr);
+}
+
+void operator delete(void *Ptr, const std::nothrow_t &) noexcept {
+    std::free(Ptr);
+}
+
+namespace {
+    class CCountingResource final : public std::pmr::memory_resource {
+        std::pmr::memory_resource *m_pUpstream;
+        size_t m_Allocations = 0;
+        size_t m_Bytes = 0;
+
+        void *do_allocate(const size_t Bytes, const size_t Alignment) override {
+            ++m_Allocations;
+            m_Bytes += Bytes;
+            return m_pUpstream->allocate(Bytes, Alignment);
+        }
+
+        void do_deallocate(void *Ptr, const size_t Bytes, const size_t Alignment) override {
+            m_pUpstream->deallocate(Ptr, Bytes, Alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const memory_resource &Other) const noexcept override {
+            return this == &Other;
+        }
+
+    public:
+        explicit CCountingResource(std::pmr::memory_resource *pUpstream) : m_pUpstream(pUpstream) {}
+
+        [[nodiscard]] size_t Allocations() const { return m_Allocations; }
+        [[nodiscard]] size_t Bytes() const { return m_Bytes; }
+    };
+}
+
+class PmrTest : public ::testing::Test {
+protected:
+    alignas(std::max_align_t) char m_aArena[32 * 1024];
+    std::pmr::monotonic_buffer_resource m_Monotonic{m_aArena, sizeof(m_aArena), std::pmr::null_memory_resource()};
+    CCountingResource m_Counting{&m_Monotonic};
+    std::pmr::memory_resource *m_pPreviousDefault = nullptr;
+
+    void SetUp() override {
+        // Anything silently falling back to the default resource fails loudly
+        m_pPreviousDefault = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    }
+
+    void TearDown() override {
+        std::pmr::set_default_resource(m_pPreviousDefault);
+    }
+};
+
+TEST_F(PmrTest, ParseMatchesHeapParse) {
+    const std::string_view Input = "1y 2mo 3d 4hours 5minutes 6seconds 90 17ms";
+    const auto Expected = CTimePeriod::Parse(Input);
+
+    EXPECT_EQ(CTimePeriod::Parse(Input, &m_Counting), Expected);
+    EXPECT_GT(m_Counting.Allocations(), 0);
+}
+
+TEST_F(PmrTest, RequestStaysInArena) {
+    // One-time per-thread setup (e.g. instrumentation registration) is not part of the request
+    (void)CTimePeriod::Parse("1s", &m_Counting);
+    const size_t Before = g_GlobalAllocations;
+
+    const CTimePeriod Period(CTimePeriod::Parse("2d 5h 30m 15s 123456789012345s", &m_Counting));
+    const auto Text = Period.toString(&m_Counting);
+    const auto Sql = Period.asSqlInterval(&m_Counting);
+    const auto Iso = ToIso8601(Period, &m_Counting);
+
+    const std::pmr::polymorphic_allocator<char> Allocator(&m_Counting);
+    CPmrScanner Scanner("1hours 30 45seconds unknown 5x", DefaultTokens(Allocator), Allocator);
+    const auto Result = Scanner.ScanTokens();
+
+    const size_t After = g_GlobalAllocations;
+
+    EXPECT_EQ(After - Before, 0);
+    EXPECT_GT(m_Counting.Bytes(), 0);
+    EXPECT_EQ(std::string_view(Text), Period.toString());
+    EXPECT_EQ(std::string_view(Sql), Period.asSqlInterval());
+    EXPECT_EQ(std::string_view(Iso), ToIso8601(Period));
+    ASSERT_EQ(Result.size(), 3);
+    EXPECT_EQ(Result.at(3600), 1);
+    EXPECT_EQ(Result.at(60), 30);
+    EXPECT_EQ(Result.at(1), 45);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <timeduration/ratelimit.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+namespace {
+    // Time is passed explicitly in these tests, the clock only provides the types
+    using CTestLimiter = CBasicRateLimiter<std::chrono::steady_clock>;
+
+    std::chrono::steady_clock::time_point At(const std::chrono::nanoseconds Offset) {
+        return std::chrono::steady_clock::time_point(1h + Offset);
+    }
+}
+
+TEST(RateLimitTest, ParsesSpecs) {
+    SRateLimit Limit;
+    ASSERT_TRUE(TryParseRateLimit("100 per 1m", Limit));
+    EXPECT_EQ(Limit.m_Count, 100u);
+    EXPECT_EQ(Limit.m_Period.duration(), 60s);
+
+    ASSERT_TRUE(TryParseRateLimit("  5/30s ", Limit));
+    EXPECT_EQ(Limit.m_Count, 5u);
+    EXPECT_EQ(Limit.m_Period.duration(), 30s);
+
+    ASSERT_TRUE(TryParseRateLimit("1000 per 1h 30m", Limit));
+    EXPECT_EQ(Limit.m_Period.duration(), 5400s);
+
+    ASSERT_TRUE(TryParseRateLimit("10 per s", Limit));
+    EXPECT_EQ(Limit.m_Period.duration(), 1s);
+    ASSERT_TRUE(TryParseRateLimit("10 per hours", Limit));
+    EXPECT_EQ(Limit.m_Period.duration(), 1h);
+
+    // Bare numbers are minutes, as everywhere else
+    ASSERT_TRUE(TryParseRateLimit("3 per 2", Limit));
+    EXPECT_EQ(Limit.m_Period.duration(), 120s);
+}
+
+TEST(RateLimitTest, RejectsBadSpecs) {
+    SRateLimit Limit;
+    for (const char *pSpec: {"", "per 1m", "0 per 1m", "100", "100 per", "100 per 0s", "100 perm 1m", "100 per1m",
+                             "100 every 1m", "x per 1m", "18446744073709551616 per 1s", "1 per 300y"})
+        EXPECT_FALSE(TryParseRateLimit(pSpec, Limit)) << pSpec;
+    EXPECT_TRUE(TryParseRateLimit("18446744073709551615 per 1s", Limit));
+
+    EXPECT_FALSE(TryParseRateLimit("1 per 1s", Limit, SParseLimits{100, 1}));
+    EXPECT_TRUE(TryParseRateLimit("1 per 1s", Limit, SParseLimits{100, 2}));
+    EXPECT_FALSE(TryParseRateLimit("1 per 1s", Limit, SParseLimits{7, 2}));
+
+    EXPECT_THROW((void)ParseRateLimit("100 per"), std::invalid_argument);
+    EXPECT_THROW(CRateLimiter("oops"), std::invalid_argument);
+    EXPECT_THROW(CRateLimiter("18446744073709551615 per 1s"), std::invalid_argument);
+}
+
+TEST(RateLimitTest, AllowsBurstThenSpacesPermits) {
+    CTestLimiter Limiter("4 per 1s");
+    EXPECT_EQ(Limiter.Interval(), 250ms);
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(Limiter.TryAcquire(At(0ns))) << i;
+    EXPECT_FALSE(Limiter.TryAcquire(At(0ns)));
+    EXPECT_EQ(Limiter.TimeUntilAvailable(At(0ns)), 250ms);
+    EXPECT_EQ(Limiter.TimeUntilAvailable(At(100ms)), 150ms);
+
+    EXPECT_FALSE(Limiter.TryAcquire(At(249ms)));
+    EXPECT_TRUE(Limiter.TryAcquire(At(250ms)));
+    EXPECT_FALSE(Limiter.TryAcquire(At(250ms)));
+
+    // After a long idle spell the bucket is full again, but no fuller
+    int Granted = 0;
+    while (Limiter.TryAcquire(At(1h)))
+        ++Granted;
+    EXPECT_EQ(Granted, 4);
+    EXPECT_EQ(Limiter.TimeUntilAvailable(At(2h)), 0ns);
+}
+
+TEST(RateLimitTest, ExplicitBurstAndCost) {
+    CTestLimiter Limiter(SRateLimit{10, CTimePeriod(1)}, 2);
+    EXPECT_TRUE(Limiter.TryAcquire(At(0ns), 2));
+    EXPECT_FALSE(Limiter.TryAcquire(At(0ns)));
+    EXPECT_FALSE(Limiter.TryAcquire(At(100ms), 2));
+    EXPECT_TRUE(Limiter.TryAcquire(At(200ms), 2));
+
+    EXPECT_FALSE(Limiter.TryAcquire(At(1h), 3)); // more than the burst, never granted
+    EXPECT_TRUE(Limiter.TryAcquire(At(1h), 0));
+    EXPECT_TRUE(Limiter.TryAcquire(At(1h), 2));
+}
+
+TEST(RateLimitTest, ConcurrentAcquiresNeverExceedTheLimit) {
+    constexpr int NUM_THREADS = 8;
+    CTestLimiter Limiter("1000 per 1h");
+
+    std::atomic<int> Granted{0};
+    std::vector<std::thread> vThreads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        vThreads.emplace_back([&Limiter, &Granted] {
+            for (int i = 0; i < 1000; ++i)
+                Granted += Limiter.TryAcquire(At(0ns));
+        });
+    }
+    for (auto &Thread: vThreads)
+        Thread.join();
+    EXPECT_EQ(Granted.load(), 1000);
+}
+
+TEST(RateLimitTest, UsesTheClockByDefault) {
+    CRateLimiter Limiter("2 per 1h");
+    EXPECT_TRUE(Limiter.TryAcquire());
+    EXPECT_TRUE(Limiter.TryAcquire());
+    EXPECT_FALSE(Limiter.TryAcquire());
+    EXPECT_GT(Limiter.TimeUntilAvailable(), 1790s);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <timeduration/sort.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace timeduration;
+
+class SortTest : public ::testing::Test {
+protected:
+    static std::vector<int64_t> RandomTotals(const size_t Count, const int64_t Min, const int64_t Max) {
+        std::mt19937_64 Rng(42);
+        std::uniform_int_distribution<int64_t> Dist(Min, Max);
+        std::vector<int64_t> Totals(Count);
+        for (auto &Total: Totals)
+            Total = Dist(Rng);
+        return Totals;
+    }
+};
+
+TEST_F(SortTest, SortsTotalsLikeStdSort) {
+    for (const size_t Count: {0, 1, 7, 63, 64, 1000, 100000}) {
+        auto Totals = RandomTotals(Count, 0, 10 * 86400);
+        auto Expected = Totals;
+        std::sort(Expected.begin(), Expected.end());
+
+        SortDurations(Totals);
+        EXPECT_EQ(Totals, Expected) << "Count: " << Count;
+    }
+}
+
+TEST_F(SortTest, HandlesNegativeAndExtremeTotals) {
+    auto Totals = RandomTotals(5000, -1000000, 1000000);
+    Totals.push_back(std::numeric_limits<int64_t>::min());
+    Totals.push_back(std::numeric_limits<int64_t>::max());
+    Totals.push_back(0);
+    Totals.push_back(-1);
+    auto Expected = Totals;
+    std::sort(Expected.begin(), Expected.end());
+
+    SortDurations(Totals);
+    EXPECT_EQ(Totals, Expected);
+}
+
+TEST_F(SortTest, CarriesPayloadStably) {
+    // Few distinct values so stability actually matters
+    auto Totals = RandomTotals(10000, 0, 16);
+    std::vector<uint32_t> Payload(Totals.size());
+    std::iota(Payload.begin(), Payload.end(), 0u);
+
+    std::vector<std::pair<int64_t, uint32_t>> Expected;
+    for (size_t i = 0; i < Totals.size(); ++i)
+        Expected.emplace_back(Totals[i], Payload[i]);
+    std::stable_sort(Expected.begin(), Expected.end(),
+                     [](const auto &Lhs, const auto &Rhs) { return Lhs.first < Rhs.first; });
+
+    SortDurations(std::span<int64_t>(Totals), std::span<uint32_t>(Payload));
+
+    for (size_t i = 0; i < Totals.size(); ++i) {
+        ASSERT_EQ(Totals[i], Expected[i].first);
+        ASSERT_EQ(Payload[i], Expected[i].second);
+    }
+}
+
+TEST_F(SortTest, RejectsPayloadOfDifferentSize) {
+    std::vector<int64_t> Totals{3, 1, 2};
+    std::vector<uint32_t> Short{0, 1};
+    EXPECT_THROW(SortDurations(std::span<int64_t>(Totals), std::span<uint32_t>(Short)), std::invalid_argument);
+    EXPECT_EQ(Totals, (std::vector<int64_t>{3, 1, 2}));
+}
+
+TEST_F(SortTest, SortsTimePeriods) {
+    std::vector<CTimePeriod> Periods;
+    for (const auto Total: RandomTotals(2000, 0, 400 * 86400))
+        Periods.emplace_back(std::chrono::seconds(Total));
+    auto Expected = Periods;
+    std::stable_sort(Expected.begin(), Expected.end());
+
+    SortDurations(Periods);
+
+    ASSERT_EQ(Periods.size(), Expected.size());
+    for (size_t i = 0; i < Periods.size(); ++i) {
+        EXPECT_EQ(Periods[i], Expected[i]);
+        EXPECT_EQ(Periods[i].days(), Expected[i].days());
+        EXPECT_EQ(Periods[i].seconds(), Expected[i].seconds());
+    }
+}
+
+TEST_F(SortTest, TopKMatchesPartialSort) {
+    const auto Totals = RandomTotals(50000, 0, 1000);
+    std::vector<size_t> Indices(Totals.size());
+    std::iota(Indices.begin(), Indices.end(), size_t{0});
+    std::stable_sort(Indices.begin(), Indices.end(),
+                     [&](const size_t Lhs, const size_t Rhs) { return Totals[Lhs] > Totals[Rhs]; });
+
+    std::vector<size_t> Out(100);
+    ASSERT_EQ(TopK(Totals, Out), 100);
+    EXPECT_TRUE(std::equal(Out.begin(), Out.end(), Indices.begin()));
+}
+
+TEST_F(SortTest, TopKClampsToInputSize) {
+    const std::vector<int64_t> Totals = {30, 10, 20};
+    std::vector<size_t> Out(10, 99);
+
+    ASSERT_EQ(TopK(Totals, Out), 3);
+    EXPECT_EQ(Out[0], 0);
+    EXPECT_EQ(Out[1], 2);
+    EXPECT_EQ(Out[2], 1);
+    EXPECT_EQ(Out[3], 99);
+
+    EXPECT_EQ(TopK(std::span<const int64_t>(), Out), 0);
+}
+
+TEST_F(SortTest, TopKOverTimePeriods) {
+    const std::vector<CTimePeriod> Periods = {
+        CTimePeriod("5h 30m"), CTimePeriod("15m"), CTimePeriod("3h 15m"),
+        CTimePeriod("30s"), CTimePeriod("5h 30m"),
+    };
+    std::vector<size_t> Out(3);
+
+    ASSERT_EQ(TopK(Periods, Out), 3);
+    EXPECT_EQ(Out[0], 0);
+    EXPECT_EQ(Out[1], 4);
+    EXPECT_EQ(Out[2], 2);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <timeduration/sql.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace timeduration;
+
+namespace {
+    std::string Single(const ESqlDialect Dialect, const int64_t Seconds) {
+        char Buffer[64];
+        const size_t Length = WriteSqlInterval(Dialect, std::chrono::seconds(Seconds), Buffer);
+        EXPECT_EQ(Length, SqlIntervalLength(Dialect, std::chrono::seconds(Seconds)));
+        return {Buffer, Length};
+    }
+}
+
+TEST(SqlTest, WritesEachDialect) {
+    EXPECT_EQ(Single(ESqlDialect::GENERIC, 9000), "interval 9000 second");
+    EXPECT_EQ(Single(ESqlDialect::POSTGRESQL, 9000), "interval '9000 seconds'");
+    EXPECT_EQ(Single(ESqlDialect::MYSQL, 9000), "INTERVAL 9000 SECOND");
+    EXPECT_EQ(Single(ESqlDialect::CLICKHOUSE, 9000), "toIntervalSecond(9000)");
+    EXPECT_EQ(Single(ESqlDialect::SQLITE, 9000), "9000");
+}
+
+TEST(SqlTest, GenericMatchesAsSqlInterval) {
+    for (const auto *Input: {"0s", "1h", "2h 30m", "999d 23h 59m 59s"}) {
+        const CTimePeriod Period(Input);
+        EXPECT_EQ(Single(ESqlDialect::GENERIC, Period.duration().count()), Period.asSqlInterval());
+    }
+}
+
+TEST(SqlTest, WritesNegativeAndExtremeValues) {
+    EXPECT_EQ(Single(ESqlDialect::MYSQL, -60), "INTERVAL -60 SECOND");
+    EXPECT_EQ(Single(ESqlDialect::SQLITE, std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(Single(ESqlDialect::SQLITE, std::numeric_limits<int64_t>::max()), "9223372036854775807");
+}
+
+TEST(SqlTest, RejectsSmallBuffers) {
+    char Buffer[8];
+    EXPECT_EQ(WriteSqlInterval(ESqlDialect::GENERIC, std::chrono::seconds(1), Buffer), 0);
+
+    const std::vector<CTimePeriod> Periods = {CTimePeriod("1h"), CTimePeriod("2h")};
+    EXPECT_EQ(WriteSqlIntervals(Buffer, Periods, ESqlDialect::SQLITE), 0);
+}
+
+TEST(SqlTest, AppendsWholeSpans) {
+    const std::vector<CTimePeriod> Periods = {CTimePeriod("1h"), CTimePeriod("30m"), CTimePeriod("0s")};
+
+    std::string Sql = "VALUES (";
+    AppendSqlIntervals(Sql, Periods, ESqlDialect::POSTGRESQL, "), (");
+    Sql += ")";
+    EXPECT_EQ(Sql, "VALUES (interval '3600 seconds'), (interval '1800 seconds'), (interval '0 seconds')");
+
+    char Buffer[128];
+    const size_t Length = WriteSqlIntervals(Buffer, Periods, ESqlDialect::CLICKHOUSE);
+    EXPECT_EQ(std::string_view(Buffer, Length), "toIntervalSecond(3600), toIntervalSecond(1800), toIntervalSecond(0)");
+
+    std::string Empty;
+    AppendSqlIntervals(Empty, std::span<const CTimePeriod>(), ESqlDialect::MYSQL);
+    EXPECT_TRUE(Empty.empty());
+}
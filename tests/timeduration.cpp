@@ -14,7 +14,7 @@ protected:
 
 class CScannerTest : public ::testing::Test {
 protected:
-    static CTimePeriod::TokenHolder GetDefaultTokens() {
+    static TokenHolder GetDefaultTokens() {
         return {
             {"s", 1L}, {"seconds", 1L},
             {"m", 60L}, {"minutes", 60L},
@@ -27,7 +27,7 @@ protected:
 };
 
 TEST_F(CScannerTest, ParsesSingleUnit) {
-    CTimePeriod::CScanner scanner("5s", GetDefaultTokens());
+    CScanner scanner("5s", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 1);
@@ -35,7 +35,7 @@ TEST_F(CScannerTest, ParsesSingleUnit) {
 }
 
 TEST_F(CScannerTest, ParsesMultipleUnits) {
-    CTimePeriod::CScanner scanner("2h 30m 15s", GetDefaultTokens());
+    CScanner scanner("2h 30m 15s", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 3);
@@ -45,7 +45,7 @@ TEST_F(CScannerTest, ParsesMultipleUnits) {
 }
 
 TEST_F(CScannerTest, ParsesLongFormUnits) {
-    CTimePeriod::CScanner scanner("1hours 30minutes 45seconds", GetDefaultTokens());
+    CScanner scanner("1hours 30minutes 45seconds", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 3);
@@ -55,7 +55,7 @@ TEST_F(CScannerTest, ParsesLongFormUnits) {
 }
 
 TEST_F(CScannerTest, ParsesDaysAndLargerUnits) {
-    CTimePeriod::CScanner scanner("1y 2mo 3d", GetDefaultTokens());
+    CScanner scanner("1y 2mo 3d", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 3);
@@ -65,7 +65,7 @@ TEST_F(CScannerTest, ParsesDaysAndLargerUnits) {
 }
 
 TEST_F(CScannerTest, HandlesLargeNumbers) {
-    CTimePeriod::CScanner scanner("999h 123456s", GetDefaultTokens());
+    CScanner scanner("999h 123456s", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 2);
@@ -74,7 +74,7 @@ TEST_F(CScannerTest, HandlesLargeNumbers) {
 }
 
 TEST_F(CScannerTest, HandlesDuplicateUnits) {
-    CTimePeriod::CScanner scanner("5m 10m", GetDefaultTokens());
+    CScanner scanner("5m 10m", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 1);
@@ -82,14 +82,14 @@ TEST_F(CScannerTest, HandlesDuplicateUnits) {
 }
 
 TEST_F(CScannerTest, HandlesEmptyString) {
-    CTimePeriod::CScanner scanner("", GetDefaultTokens());
+    CScanner scanner("", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     EXPECT_EQ(result.size(), 0);
 }
 
 TEST_F(CScannerTest, HandlesNumberWithoutUnit) {
-    CTimePeriod::CScanner scanner("120", GetDefaultTokens());
+    CScanner scanner("120", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 1);
@@ -97,7 +97,7 @@ TEST_F(CScannerTest, HandlesNumberWithoutUnit) {
 }
 
 TEST_F(CScannerTest, HandlesMixedFormats) {
-    CTimePeriod::CScanner scanner("1h 90 30s", GetDefaultTokens());
+    CScanner scanner("1h 90 30s", GetDefaultTokens());
     auto result = scanner.ScanTokens();
 
     ASSERT_EQ(result.size(), 3);
@@ -140,6 +140,28 @@ TEST_F(CTimePeriodTest, HandlesLargeNumbers) {
     EXPECT_EQ(duration.count(), 999 * 3600);
 }
 
+TEST_F(CTimePeriodTest, TryParseMatchesParse) {
+    std::vector<std::string> testCases = {
+        "", "0s", "5s", "2h 30m 15s", "1hours 30minutes 45seconds", "1y 2mo 3d",
+        "5m 10m", "120", "1h 90 30s", "5h invalid", "1 hours", "10ms", "abc 7d xyz"
+    };
+
+    for (const auto& testCase : testCases) {
+        std::chrono::seconds duration{-1};
+        ASSERT_TRUE(CTimePeriod::TryParse(testCase, duration)) << "Input: " << testCase;
+        EXPECT_EQ(duration, CTimePeriod::Parse(testCase)) << "Input: " << testCase;
+    }
+}
+
+TEST_F(CTimePeriodTest, TryParseRejectsOverflow) {
+    std::chrono::seconds duration{0};
+    EXPECT_FALSE(CTimePeriod::TryParse("99999999999999999999s", duration));
+    EXPECT_FALSE(CTimePeriod::TryParse("9223372036854775807h", duration));
+    EXPECT_FALSE(CTimePeriod::TryParse("9223372036854775807s 1s", duration));
+    EXPECT_TRUE(CTimePeriod::TryParse("9223372036854775807s", duration));
+    EXPECT_EQ(duration.count(), std::numeric_limits<int64_t>::max());
+}
+
 // ========== Constructor Tests ==========
 
 TEST_F(CTimePeriodTest, ConstructorFromComponents) {
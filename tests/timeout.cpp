@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+#include <timeduration/timeout.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace timeduration;
+using namespace std::chrono_literals;
+
+using Clock = CTimeoutService::Clock;
+
+TEST(TimeoutTest, FiresInDeadlineOrderAndNeverEarly) {
+    CTimeoutService Service(0ms);
+    std::mutex Mutex;
+    std::vector<int> vOrder;
+    std::latch Done(3);
+    const auto Start = Clock::now();
+    std::vector<Clock::duration> vElapsed(3);
+
+    for (const int Delay: {30, 10, 20}) {
+        Service.Schedule(std::chrono::milliseconds(Delay), [&, Delay] {
+            const std::lock_guard Lock(Mutex);
+            vOrder.push_back(Delay);
+            vElapsed[Delay / 10 - 1] = Clock::now() - Start;
+            Done.count_down();
+        });
+    }
+    Done.wait();
+
+    EXPECT_EQ(vOrder, (std::vector{10, 20, 30}));
+    for (size_t i = 0; i < vElapsed.size(); ++i)
+        EXPECT_GE(vElapsed[i], std::chrono::milliseconds(10 * (i + 1)));
+    EXPECT_EQ(Service.Stats().m_Fired, 3u);
+    EXPECT_EQ(Service.Pending(), 0u);
+}
+
+TEST(TimeoutTest, CoalescesDeadlinesWithinTheSlack) {
+    CTimeoutService Service(50ms);
+    // Aligned to the start of a window so every deadline rounds up to the same one
+    const auto Window = Clock::time_point(Clock::now().time_since_epoch() / 50ms * 50ms + 100ms);
+    std::latch Done(20);
+    std::atomic<bool> Early = false;
+
+    for (int i = 0; i < 20; ++i) {
+        const auto Deadline = Window - std::chrono::milliseconds(i);
+        Service.Schedule(Deadline, [&, Deadline] {
+            if (Clock::now() < Deadline)
+                Early = true;
+            Done.count_down();
+        });
+    }
+    Done.wait();
+
+    EXPECT_FALSE(Early);
+    EXPECT_EQ(Service.Stats().m_Batches, 1u);
+    EXPECT_EQ(Service.Stats().m_Fired, 20u);
+}
+
+TEST(TimeoutTest, SchedulesCTimePeriods) {
+    CTimeoutService Service;
+    std::latch Done(1);
+    Service.Schedule(CTimePeriod("0s"), [&] { Done.count_down(); });
+    Done.wait();
+    EXPECT_EQ(Service.Stats().m_Fired, 1u);
+}
+
+TEST(TimeoutTest, CancelDropsThePendingCallback) {
+    CTimeoutService Service(1ms);
+    std::atomic<int> Fired = 0;
+    const auto pCapture = std::make_shared<int>(0);
+
+    const auto Cancelled = Service.Schedule(20ms, [&, pCapture] { ++Fired; });
+    EXPECT_EQ(Service.Pending(), 1u);
+    EXPECT_TRUE(Service.Cancel(Cancelled));
+    EXPECT_FALSE(Service.Cancel(Cancelled));
+    EXPECT_EQ(pCapture.use_count(), 1);
+    EXPECT_EQ(Service.Pending(), 0u);
+
+    std::latch Done(1);
+    const auto Kept = Service.Schedule(40ms, [&] {
+        ++Fired;
+        Done.count_down();
+    });
+    Done.wait();
+    EXPECT_EQ(Fired, 1);
+    EXPECT_FALSE(Service.Cancel(Kept));
+    EXPECT_FALSE(Service.Cancel(12345));
+    EXPECT_EQ(Service.Stats().m_Cancelled, 1u);
+}
+
+TEST(TimeoutTest, CancelRemovesTheTimerFromItsWindow) {
+    CTimeoutService Service(50ms);
+    const auto Window = Clock::time_point(Clock::now().time_since_epoch() / 50ms * 50ms + 100ms);
+    std::vector<int> vFired;
+    std::mutex Mutex;
+    std::vector<CTimeoutService::TimerId> vIds;
+    for (int i = 0; i < 4; ++i) {
+        vIds.push_back(Service.Schedule(Window - std::chrono::milliseconds(i), [&, i] {
+            const std::lock_guard Lock(Mutex);
+            vFired.push_back(i);
+        }));
+    }
+
+    // The last timer is moved into the first slot, its new index must still cancel it
+    EXPECT_TRUE(Service.Cancel(vIds[0]));
+    EXPECT_TRUE(Service.Cancel(vIds[3]));
+    EXPECT_EQ(Service.Pending(), 2u);
+    EXPECT_TRUE(Service.Cancel(vIds[1]));
+    EXPECT_TRUE(Service.Cancel(vIds[2]));
+    EXPECT_EQ(Service.Pending(), 0u);
+
+    // A window left empty is gone and never fires
+    std::this_thread::sleep_until(Window + 50ms);
+    EXPECT_TRUE(vFired.empty());
+    EXPECT_EQ(Service.Stats().m_Batches, 0u);
+    EXPECT_EQ(Service.Stats().m_Cancelled, 4u);
+
+    std::latch Done(2);
+    const auto Later = Clock::time_point(Clock::now().time_since_epoch() / 50ms * 50ms + 100ms);
+    for (int i = 4; i < 7; ++i) {
+        vIds.push_back(Service.Schedule(Later - std::chrono::milliseconds(i), [&, i] {
+            {
+                const std::lock_guard Lock(Mutex);
+                vFired.push_back(i);
+            }
+            Done.count_down();
+        }));
+    }
+    EXPECT_TRUE(Service.Cancel(vIds[4]));
+    Done.wait();
+    const std::lock_guard Lock(Mutex);
+    std::sort(vFired.begin(), vFired.end());
+    EXPECT_EQ(vFired, (std::vector{5, 6}));
+    EXPECT_EQ(Service.Stats().m_Batches, 1u);
+}
+
+TEST(TimeoutTest, CallbacksMayScheduleMoreTimers) {
+    CTimeoutService Service(1ms);
+    std::latch Done(1);
+    Service.Schedule(5ms, [&] { Service.Schedule(5ms, [&] { Done.count_down(); }); });
+    Done.wait();
+    EXPECT_EQ(Service.Stats().m_Fired, 2u);
+}
+
+TEST(TimeoutTest, SleepForBlocksUntilTheDeadline) {
+    CTimeoutService Service(1ms);
+    const auto Start = Clock::now();
+    Service.SleepFor(CTimePeriod("1s"));
+    EXPECT_GE(Clock::now() - Start, 1s);
+
+    Service.SleepFor(CTimePeriod("0s"));
+
+    std::vector<std::thread> vSleepers;
+    for (int i = 0; i < 8; ++i)
+        vSleepers.emplace_back([&Service] { Service.SleepFor(CTimePeriod("0s")); });
+    for (auto &Sleeper: vSleepers)
+        Sleeper.join();
+    EXPECT_EQ(Service.Stats().m_Fired, 10u);
+}
+
+TEST(TimeoutTest, DelaysBeyondTheClockRangeSaturate) {
+    CTimeoutService Service(1ms);
+    std::atomic<int> Fired = 0;
+    Service.Schedule(CTimePeriod("300y"), [&] { ++Fired; });
+    Service.Schedule(CTimePeriod(std::chrono::seconds::max()), [&] { ++Fired; });
+    Service.Schedule(Clock::duration::max(), [&] { ++Fired; });
+
+    // A negative period is already due
+    std::latch Done(1);
+    Service.Schedule(CTimePeriod(std::chrono::seconds::min()), [&] { Done.count_down(); });
+    Done.wait();
+
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(Fired, 0);
+    EXPECT_EQ(Service.Pending(), 3u);
+}
+
+TEST(TimeoutTest, DestructorDropsPendingTimers) {
+    std::atomic<bool> Fired = false;
+    {
+        CTimeoutService Service;
+        Service.Schedule(CTimePeriod("1h"), [&] { Fired = true; });
+        EXPECT_EQ(Service.Pending(), 1u);
+    }
+    EXPECT_FALSE(Fired);
+}
+
+TEST(BackoffTest, DoublesUpToTheMaximum) {
+    CBackoff Backoff("1s", "1m");
+    std::vector<int64_t> vDelays;
+    for (int i = 0; i < 9; ++i)
+        vDelays.push_back(Backoff.Next().duration().count());
+    EXPECT_EQ(vDelays, (std::vector<int64_t>{1, 2, 4, 8, 16, 32, 60, 60, 60}));
+    EXPECT_EQ(Backoff.Attempts(), 9u);
+
+    Backoff.Reset();
+    EXPECT_EQ(Backoff.Attempts(), 0u);
+    EXPECT_EQ(Backoff.Next().duration(), 1s);
+}
+
+TEST(BackoffTest, CustomFactorAndSaturation) {
+    CBackoff Triple(CTimePeriod("10s"), CTimePeriod("5m"), 3);
+    EXPECT_EQ(Triple.Next().duration(), 10s);
+    EXPECT_EQ(Triple.Next().duration(), 30s);
+    EXPECT_EQ(Triple.Next().duration(), 90s);
+    EXPECT_EQ(Triple.Next().duration(), 270s);
+    EXPECT_EQ(Triple.Next().duration(), 300s);
+
+    CBackoff Constant("5s", "5s", 1);
+    EXPECT_EQ(Constant.Next().duration(), 5s);
+    EXPECT_EQ(Constant.Next().duration(), 5s);
+
+    // Growth near the top of the range must not overflow
+    CBackoff Huge(CTimePeriod(std::chrono::seconds(1)), CTimePeriod(std::chrono::seconds::max()), 1000000);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_GT(Huge.Next().duration(), 0s);
+    EXPECT_EQ(Huge.Next().duration(), std::chrono::seconds::max());
+}
+
+TEST(BackoffTest, RejectsInvalidSchedules) {
+    EXPECT_THROW(CBackoff("0s", "1m"), std::invalid_argument);
+    EXPECT_THROW(CBackoff("1m", "1s"), std::invalid_argument);
+    EXPECT_THROW(CBackoff("1s", "1m", 0), std::invalid_argument);
+    EXPECT_THROW(CBackoff("1x", "1m"), std::invalid_argument);
+}